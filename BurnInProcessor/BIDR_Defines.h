@@ -154,6 +154,8 @@ namespace burn_in_data_report
         std::string file_name;
         nano internal_time;
         timepoint start_time;
+        uinteger row_offset; // First row of the file in the combined columns
+        uinteger n_rows;     // Number of rows the file contributes
     };
 #pragma pack()
 
@@ -1403,6 +1405,27 @@ namespace burn_in_data_report
         return sa_result.Detach();
     }
 
+    // As array_convert, for a column view (see column_view), its rows are read in place
+    template <typename To, typename View, typename F>
+    LPSAFEARRAY
+    view_convert( const View& view, const F& conversion_op ) {
+        // Create a column-wise SAFEARRAY
+        SAFEARRAYBOUND bounds[2];
+        bounds[1].cElements = 1;
+        bounds[1].lLbound = 0;
+        bounds[0].cElements = static_cast<ULONG>(view.size());
+        bounds[0].lLbound = 0;
+        CComSafeArray<To> sa_result( bounds, 2 );
+
+        LONG indexes[2] { 0, 0 };
+        view.for_each([&]( const auto& x ) {
+            sa_result.MultiDimSetAt( indexes, conversion_op(x) );
+            ++indexes[0];
+        });
+
+        return sa_result.Detach();
+    }
+
     /*inline LPSAFEARRAY
     array_convert( const std::vector<std::string>& data,
                    const std::function<VARIANT(const std::string&)>& conversion_op,
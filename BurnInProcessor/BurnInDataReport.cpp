@@ -3,6 +3,8 @@
 
 // Global spreadsheet variable
 static bidr::spreadsheet spreadsheet;
+// Options applied to the next load_files / init_spreadsheet call
+static bidr::load_options load_options;
 
 // Not exported
 BOOL WINAPI
@@ -35,7 +37,8 @@ load_files( _In_ const LPSAFEARRAY* ppsa,
                               max_off_time_minutes,
                               do_trimming == 1
                                   ? true
-                                  : false);
+                                  : false,
+                              load_options);
 
         return TRUE;
     }
@@ -64,6 +67,26 @@ clear_spreadsheet() {
     }
 }
 
+// Exported
+BOOL WINAPI
+shutdown_spreadsheet() {
+    try {
+        /*
+        * The workers must be joined here rather than by static destructors,
+        * which run under the loader lock during FreeLibrary & deadlock.
+        * Clearing drops file_data's hold on the pool, so releasing it joins.
+        */
+        if ( !spreadsheet.clear_spreadsheet() ) { throw std::runtime_error("Failed to clear spreadsheet."); }
+        bidr::release_shared_thread_pool();
+        write_log("Worker threads stopped.");
+        return TRUE;
+    }
+    catch ( const std::exception& err ) {
+        write_err_log(err, "DLL: <shutdown_spreadsheet>");
+        return FALSE;
+    }
+}
+
 // Exported
 BOOL WINAPI
 init_spreadsheet( _In_ const LPSAFEARRAY* ppsa,
@@ -87,6 +110,105 @@ init_spreadsheet( _In_ const LPSAFEARRAY* ppsa,
     }
 }
 
+// Exported
+BOOL WINAPI
+set_ingest_mode( const uinteger& mode ) {
+    try {
+        const auto ingest { static_cast<bidr::ingest_mode>( mode ) };
+        if ( ingest != bidr::ingest_mode::copy && ingest != bidr::ingest_mode::mapped ) {
+            throw std::out_of_range(std::format("Invalid ingest mode: {}", mode));
+        }
+        load_options.ingest = ingest;
+        write_log(std::format("Ingest mode set: {}", mode));
+        return TRUE;
+    }
+    catch ( const std::exception& err ) {
+        write_err_log(err, "DLL: <set_ingest_mode>");
+        return FALSE;
+    }
+}
+
+// Exported
+BOOL WINAPI
+set_thread_count( const uinteger& n_threads ) {
+    try {
+        load_options.n_threads = n_threads;
+        write_log(std::format("Thread count set: {}", n_threads));
+        return TRUE;
+    }
+    catch ( const std::exception& err ) {
+        write_err_log(err, "DLL: <set_thread_count>");
+        return FALSE;
+    }
+}
+
+// Exported
+BOOL WINAPI
+set_load_columns( LPSAFEARRAY* ppsa ) {
+    try {
+        CComSafeArray<VARIANT> csa(*ppsa);
+
+        const auto arr {
+                bidr::array_convert<VARIANT, std::string>(
+                                                          csa, []( const VARIANT& v ) {
+                                                              return bidr::bstr_string_convert(v);
+                                                          }
+                                                         )
+            };
+        *ppsa = csa.Detach();
+        load_options.columns = std::set<std::string> { arr.begin(), arr.end() };
+        write_log(std::format("Load columns set: {} (0 = all)", load_options.columns.size()));
+        return TRUE;
+    }
+    catch ( const std::exception& err ) {
+        write_err_log(err, "DLL: <set_load_columns>");
+        return FALSE;
+    }
+}
+
+// Exported
+BOOL WINAPI
+set_lazy_load( const bool lazy ) {
+    try {
+        load_options.lazy = lazy;
+        write_log(std::format("Lazy loading set: {}", lazy));
+        return TRUE;
+    }
+    catch ( const std::exception& err ) {
+        write_err_log(err, "DLL: <set_lazy_load>");
+        return FALSE;
+    }
+}
+
+// Exported
+BOOL WINAPI
+set_memory_budget( const uinteger& megabytes ) {
+    try {
+        load_options.memory_budget = megabytes * 1024 * 1024;
+        write_log(std::format("Memory budget set: {} MB (0 = no limit)", megabytes));
+        return TRUE;
+    }
+    catch ( const std::exception& err ) {
+        write_err_log(err, "DLL: <set_memory_budget>");
+        return FALSE;
+    }
+}
+
+// Exported
+BOOL WINAPI
+set_cache_dir( LPVARIANT v_cache_dir ) {
+    try {
+        const auto cache_dir { bidr::bstr_string_convert(_bstr_t(v_cache_dir)) };
+        load_options.cache_dir = std::filesystem::path { cache_dir };
+        write_log(std::format("Parse cache directory set: \"{}\"", cache_dir));
+        return TRUE;
+    }
+    catch ( const std::exception& err ) {
+        write_err_log(err, "DLL: <set_cache_dir>");
+        return FALSE;
+    }
+}
+
 // Exported
 BOOL WINAPI
 add_file( LPVARIANT v_filename ) {
@@ -175,6 +297,73 @@ remove_files( LPSAFEARRAY* ppsa ) {
     }
 }
 
+// Exported
+BOOL WINAPI
+save_data( LPVARIANT v_path ) {
+    try {
+        const auto path { bidr::bstr_string_convert(_bstr_t(v_path)) };
+        write_log(std::format("Saving data: {}", path));
+        return spreadsheet.save(std::filesystem::path { path })
+                   ? TRUE
+                   : FALSE;
+    }
+    catch ( const std::exception& err ) {
+        write_err_log(err, "DLL: <save_data>");
+        return FALSE;
+    }
+}
+
+// Exported
+BOOL WINAPI
+open_data( LPVARIANT v_path ) {
+    try {
+        const auto path { bidr::bstr_string_convert(_bstr_t(v_path)) };
+        write_log(std::format("Opening data: {}", path));
+        return spreadsheet.open(std::filesystem::path { path })
+                   ? TRUE
+                   : FALSE;
+    }
+    catch ( const std::exception& err ) {
+        write_err_log(err, "DLL: <open_data>");
+        return FALSE;
+    }
+}
+
+// Exported
+integer WINAPI
+sql_save( LPVARIANT v_db_path ) {
+    try {
+        const auto path { bidr::bstr_string_convert(_bstr_t(v_db_path)) };
+        write_log(std::format("Storing run: {}", path));
+        bidr::sql_database db { std::filesystem::path { path } };
+        integer run_id { -1 };
+        if ( !db.store(spreadsheet, run_id) ) { return -1; }
+        return run_id;
+    }
+    catch ( const std::exception& err ) {
+        write_err_log(err, "DLL: <sql_save>");
+        return -1;
+    }
+}
+
+// Exported
+BOOL WINAPI
+sql_load( LPVARIANT v_db_path, LPVARIANT v_query ) {
+    try {
+        const auto path { bidr::bstr_string_convert(_bstr_t(v_db_path)) };
+        const auto query { bidr::bstr_string_convert(_bstr_t(v_query)) };
+        write_log(std::format("Loading from {}: {}", path, query));
+        bidr::sql_database db { std::filesystem::path { path } };
+        return db.load(query, spreadsheet)
+                   ? TRUE
+                   : FALSE;
+    }
+    catch ( const std::exception& err ) {
+        write_err_log(err, "DLL: <sql_load>");
+        return FALSE;
+    }
+}
+
 // Exported
 LPSAFEARRAY WINAPI
 get_current_cols() {
@@ -379,6 +568,15 @@ n_rows() {
     return spreadsheet.n_rows();
 }
 
+// Exported
+uinteger WINAPI
+memory_usage( const bool peak ) {
+    const auto& file_data { spreadsheet.get_file_data() };
+    const auto bytes { peak ? file_data.peak_memory_usage() : file_data.memory_usage() };
+    write_log(std::format("memory_usage ({}): {} bytes", peak ? "peak" : "current", bytes));
+    return bytes;
+}
+
 // Exported
 LPSAFEARRAY WINAPI
 get( LPVARIANT key ) {
@@ -395,33 +593,26 @@ get( LPVARIANT key ) {
         write_log(std::format("Sending {}", s_key));
 
         switch ( type ) {
+        // Columns are marshalled straight from views, without copying them first
         case DT::INTEGER:
             {
-                write_log(std::format("Size: {}", spreadsheet.get_i(s_key).size()));
-                return bidr::array_convert<integer, VARIANT>(
-                                                             spreadsheet.get_i(s_key),
-                                                             []( const integer& i ) { return _variant_t(i); },
-                                                             false
-                                                            );
+                const auto view { spreadsheet.view<integer>(s_key) };
+                write_log(std::format("Size: {}", view.size()));
+                return bidr::view_convert<VARIANT>(view, []( const integer& i ) { return _variant_t(i); });
             }
         case DT::DOUBLE:
             {
-                write_log(std::format("Size: {}", spreadsheet.get_d(s_key).size()));
-                return bidr::array_convert<double, VARIANT>(
-                                                            spreadsheet.get_d(s_key),
-                                                            []( const double& d ) { return _variant_t(d); },
-                                                            false
-                                                           );
+                const auto view { spreadsheet.view<double>(s_key) };
+                write_log(std::format("Size: {}", view.size()));
+                return bidr::view_convert<VARIANT>(view, []( const double& d ) { return _variant_t(d); });
             }
         case DT::STRING:
             {
-                write_log(std::format("Size: {}", spreadsheet.get_s(s_key).size()));
-                return bidr::array_convert<std::string, VARIANT>(
-                                                                 spreadsheet.get_s(s_key),
-                                                                 []( const std::string& s ) {
-                                                                     return _variant_t(_bstr_t(s.c_str()));
-                                                                 }
-                                                                );
+                const auto view { spreadsheet.view<std::string>(s_key) };
+                write_log(std::format("Size: {}", view.size()));
+                return bidr::view_convert<VARIANT>(view, []( const std::string_view s ) {
+                    return _variant_t(_bstr_t(std::string { s }.c_str()));
+                });
             }
         case DT::NONE: { throw std::runtime_error("Invalid type."); }
         }
@@ -446,11 +637,8 @@ get_error( LPVARIANT key ) {
         if ( const auto type { spreadsheet.type(s_key) };
             type == DT::NONE ) { throw std::out_of_range("Key not found."); }
 
-        return bidr::array_convert<double, VARIANT>(
-                                                    spreadsheet.get_error(s_key),
-                                                    []( const double& d ) { return _variant_t(d); },
-                                                    false
-                                                   );
+        return bidr::view_convert<VARIANT>(spreadsheet.view_error(s_key),
+                                           []( const double& d ) { return _variant_t(d); });
     }
     catch ( const std::exception& err ) {
         write_err_log(err, "DLL: <get_error>");
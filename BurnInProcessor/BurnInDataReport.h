@@ -37,10 +37,20 @@ extern "C"
      * Wrappers for spreadsheet class:
      *   - init_spreadsheet: DONE
      *   - load_files: DONE
+     *   - set_ingest_mode: DONE
+     *   - set_thread_count: DONE
+     *   - set_cache_dir: DONE
+     *   - set_load_columns: DONE
+     *   - set_lazy_load: DONE
+     *   - set_memory_budget: DONE
      *   - add_file: DONE
      *   - add_files: DONE
      *   - remove_file: DONE
      *   - remove_files: DONE
+     *   - save_data: DONE
+     *   - open_data: DONE
+     *   - sql_save: DONE
+     *   - sql_load: DONE
      *   - get_current_cols: DONE
      *   - get_available_cols: DONE
      *   - load_column: DONE
@@ -50,10 +60,12 @@ extern "C"
      *   - filter: DONE
      *   - apply_reduction: DONE
      *   - clear_spreadsheet: DONE
+     *   - shutdown_spreadsheet: DONE
      *   - n_rows: DONE
      *   - get: DONE (wraps get_i, get_d, get_s)
      *   - get_error: DONE
      *   - contains: DONE
+     *   - memory_usage: DONE
     */
 
     BIDR_API BOOL WINAPI
@@ -67,6 +79,10 @@ extern "C"
     BIDR_API BOOL WINAPI
     clear_spreadsheet();
 
+    // Clear spreadsheet & stop the worker threads, call before unloading the DLL (FreeLibrary)
+    BIDR_API BOOL WINAPI
+    shutdown_spreadsheet();
+
     // Initialise global spreadsheet
     BIDR_API BOOL WINAPI
     init_spreadsheet( _In_ const LPSAFEARRAY* ppsa,
@@ -76,6 +92,31 @@ extern "C"
                       _In_ const uinteger&    do_trimming,
                       _In_ LPVARIANT          log_file_path );
 
+    // Select how files are read on the next load (0: copy, 1: memory-mapped)
+    BIDR_API BOOL WINAPI
+    set_ingest_mode( _In_ const uinteger& mode );
+
+    // Number of worker threads used on the next load (0: all hardware threads)
+    BIDR_API BOOL WINAPI
+    set_thread_count( _In_ const uinteger& n_threads );
+
+    // Directory for the parse cache used on the next load (empty string: no caching)
+    BIDR_API BOOL WINAPI
+    set_cache_dir( _In_ LPVARIANT v_cache_dir );
+
+    // Columns parsed by the next load (empty array: all), others are parsed by load_column
+    BIDR_API BOOL WINAPI
+    set_load_columns( _In_ LPSAFEARRAY* ppsa );
+
+    // Parse columns on first request only (load_column), loading reads headers & time info
+    BIDR_API BOOL WINAPI
+    set_lazy_load( _In_ const bool lazy );
+
+    // Memory file data aims to stay under on the next load, in MB (0: no limit), past it per-file
+    // columns are freed once combined
+    BIDR_API BOOL WINAPI
+    set_memory_budget( _In_ const uinteger& megabytes );
+
     BIDR_API BOOL WINAPI
     add_file( LPVARIANT v_filename );
 
@@ -88,6 +129,22 @@ extern "C"
     BIDR_API BOOL WINAPI
     remove_files( LPSAFEARRAY* ppsa );
 
+    // Save the loaded data as a column store (.bidrcs)
+    BIDR_API BOOL WINAPI
+    save_data( LPVARIANT v_path );
+
+    // Replace the loaded data with a column store, columns are read as they are loaded
+    BIDR_API BOOL WINAPI
+    open_data( LPVARIANT v_path );
+
+    // Store the loaded data & cycle averaged columns as a new run in a SQLite database, returns the run id (-1 on failure)
+    BIDR_API integer WINAPI
+    sql_save( LPVARIANT v_db_path );
+
+    // Replace the loaded data with the result of a query on a SQLite database
+    BIDR_API BOOL WINAPI
+    sql_load( LPVARIANT v_db_path, LPVARIANT v_query );
+
     BIDR_API LPSAFEARRAY WINAPI
     get_current_cols();
 
@@ -124,6 +181,10 @@ extern "C"
     BIDR_API uinteger WINAPI
     n_rows();
 
+    // Bytes held by the loaded file data, or the most it has held (peak)
+    BIDR_API uinteger WINAPI
+    memory_usage( _In_ const bool peak );
+
     BIDR_API LPSAFEARRAY WINAPI
     get( LPVARIANT key );
 
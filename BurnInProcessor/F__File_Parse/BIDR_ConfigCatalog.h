@@ -0,0 +1,133 @@
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "../BIDR_Defines.h"
+#include "../S__Datastructures/BIDR_FileSchema.h"
+#include "BIDR_FileParse.h"
+
+namespace burn_in_data_report
+{
+    /*
+    * Compiled configs of a config location, a folder of .json files or a
+    * single .json file. The location is parsed once, later refreshes only
+    * re-read files whose size or last write time changed (& drop removed
+    * ones), so repeated loads normally parse no json at all.
+    */
+    class config_catalog
+    {
+    private:
+        struct entry
+        {
+            uintmax_t                          size;
+            std::filesystem::file_time_type    write_time;
+            std::shared_ptr<const file_schema> schema; // Null if the file isn't a valid config
+        };
+
+        std::filesystem::path                  location_;
+        std::map<std::filesystem::path, entry> entries_;  // By path, collisions resolve the same way every time
+        schema_map                             schemas_;
+        std::mutex                             mtx_;
+
+        // Rebuilds schemas_ from entries_, the first config with a name wins
+        void
+        index() {
+            schemas_.clear();
+            for ( const auto& [path, entry] : entries_ ) {
+                if ( !entry.schema ) { continue; }
+                if ( !schemas_.try_emplace(entry.schema->name, entry.schema).second ) {
+                    write_err_log(std::runtime_error(
+                        std::format("DLL: <config_catalog::index> namespace collision in config files ({}).",
+                                    path.string())));
+                }
+            }
+        }
+
+    public:
+        explicit config_catalog( const std::filesystem::path& _location ) :
+            location_(_location) {}
+
+        /*
+        * Brings the catalog up to date with the config location & copies
+        * the compiled configs, keyed by name, into _schemas.
+        */
+        bool
+        refresh( schema_map& _schemas ) noexcept {
+            try {
+                std::lock_guard lock { mtx_ };
+                _schemas.clear();
+
+                const std::filesystem::directory_entry location { location_ };
+                std::vector<std::filesystem::path>      found;
+                if ( !location.exists() ) {
+                    print("WARNING: <config_catalog::refresh> No external config location found.", 4);
+                }
+                else if ( location.is_directory() ) {
+                    for ( const auto& file : std::filesystem::directory_iterator(location) ) {
+                        if ( file.is_regular_file() && file.path().extension() == ".json" ) {
+                            found.push_back(file.path());
+                        }
+                    }
+                }
+                else if ( location.is_regular_file() && location_.extension() == ".json" ) { found.push_back(location_); }
+                else {
+                    write_err_log(std::runtime_error("DLL: <config_catalog::refresh> Invalid config location received."));
+                    return false;
+                }
+
+                bool changed { found.size() != entries_.size() };
+                std::map<std::filesystem::path, entry> entries;
+                for ( const auto& path : found ) {
+                    const auto size { std::filesystem::file_size(path) };
+                    const auto write_time { std::filesystem::last_write_time(path) };
+                    if ( const auto iter { entries_.find(path) };
+                        iter != entries_.end() && iter->second.size == size && iter->second.write_time == write_time ) {
+                        entries.emplace(path, std::move(iter->second));
+                        continue;
+                    }
+
+                    changed = true;
+                    entry           file { size, write_time, nullptr };
+                    nlohmann::json config;
+                    if ( parse_json(path, config) ) {
+                        try { file.schema = file_schema::compile(config); }
+                        catch ( const std::exception& err ) {
+                            write_err_log(err, std::format("DLL: <config_catalog::refresh> Invalid config file {}.",
+                                                           path.string()));
+                        }
+                    }
+                    entries.emplace(path, std::move(file));
+                }
+
+                entries_ = std::move(entries);
+                if ( changed ) {
+                    write_log(std::format("Config catalog: {} file(s) read from {}.", entries_.size(), location_.string()));
+                    index();
+                }
+
+                _schemas = schemas_;
+                return true;
+            }
+            catch ( const std::exception& err ) {
+                write_err_log(err, "DLL: <config_catalog::refresh>");
+                _schemas.clear();
+                return false;
+            }
+        }
+    };
+
+    // Process-wide catalog of each config location, kept between loads
+    inline std::shared_ptr<config_catalog>
+    shared_config_catalog( const std::filesystem::path& _location ) {
+        static std::mutex catalogs_mtx;
+        static std::map<std::filesystem::path, std::shared_ptr<config_catalog>> catalogs;
+
+        std::lock_guard lock { catalogs_mtx };
+        auto& catalog { catalogs[std::filesystem::absolute(_location)] };
+        if ( !catalog ) { catalog = std::make_shared<config_catalog>(_location); }
+        return catalog;
+    }
+} // NAMESPACE: burn_in_data_report
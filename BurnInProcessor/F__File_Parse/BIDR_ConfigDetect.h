@@ -0,0 +1,129 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "../BIDR_Defines.h"
+#include "../S__Datastructures/BIDR_FileSchema.h"
+#include "BIDR_LineIndex.h"
+#include "BIDR_Regex.h"
+
+namespace burn_in_data_report
+{
+    /*
+    * Config detection index over a set of compiled schemas. file_identifier
+    * regexes are matched against whole lines, so any match starts with the
+    * pattern's literal prefix (file_schema::identifier_prefix). The prefixes
+    * go into one trie: each header line is walked through it once, from its
+    * first char, and the full regex only runs on lines where a config's
+    * prefix hit. Configs without a literal prefix are tried on every line,
+    * as before.
+    */
+    class config_detector
+    {
+    private:
+        struct trie_node
+        {
+            std::vector<std::pair<char, uint32_t>> next; // Edges, by char
+            std::vector<uint32_t>                  ends; // Schemas whose prefix ends here
+        };
+
+        std::vector<std::shared_ptr<const file_schema>> schemas_; // In schema_map order
+        std::vector<trie_node>                          trie_;
+        uint64_t                                        signature_ { 0 };
+
+        [[nodiscard]] uint32_t
+        child( const uint32_t& _node, const char _c ) const noexcept {
+            for ( const auto& [c, node] : trie_[_node].next ) {
+                if ( c == _c ) { return node; }
+            }
+            return 0;
+        }
+
+    public:
+        config_detector() noexcept = default;
+
+        explicit config_detector( const schema_map& _schemas ) :
+            trie_(1),
+            signature_(signature_of(_schemas)) {
+            for ( const auto& schema : _schemas | std::views::values ) {
+                const auto id { static_cast<uint32_t>(schemas_.size()) };
+                schemas_.push_back(schema);
+                if ( schema->identifier_prefix.empty() ) { continue; }
+
+                uint32_t node { 0 };
+                for ( const char c : schema->identifier_prefix ) {
+                    uint32_t next { child(node, c) };
+                    if ( next == 0 ) {
+                        next = static_cast<uint32_t>(trie_.size());
+                        trie_[node].next.emplace_back(c, next);
+                        trie_.emplace_back();
+                    }
+                    node = next;
+                }
+                trie_[node].ends.push_back(id);
+            }
+        }
+
+        // Identifies a set of schemas by their names & config hashes
+        [[nodiscard]] static uint64_t
+        signature_of( const schema_map& _schemas ) {
+            std::vector<std::pair<std::string_view, uint64_t>> entries;
+            for ( const auto& [name, schema] : _schemas ) { entries.emplace_back(name, schema->hash); }
+            std::ranges::sort(entries);
+
+            uint64_t hash { fnv1a(std::string_view {}) };
+            for ( const auto& [name, config_hash] : entries ) {
+                hash = fnv1a(name, hash);
+                hash = fnv1a(std::string_view { reinterpret_cast<const char*>(&config_hash), sizeof(config_hash) }, hash);
+            }
+            return hash;
+        }
+
+        [[nodiscard]] uint64_t signature() const noexcept { return signature_; }
+
+        [[nodiscard]] const std::vector<std::shared_ptr<const file_schema>>&
+        schemas() const noexcept { return schemas_; }
+
+        /*
+        * Lines within the first _lim of _lines on which each schema's prefix
+        * hit, indexed as schemas(). Unprefixed schemas get no hits, they
+        * have to be checked against every line.
+        */
+        [[nodiscard]] std::vector<std::vector<uinteger>>
+        prefix_hits( const line_index& _lines, const uinteger& _lim ) const {
+            std::vector<std::vector<uinteger>> hits(schemas_.size());
+            if ( trie_.size() < 2 ) { return hits; }
+
+            for ( uinteger i { 0 }; i < _lim && i < _lines.size(); ++i ) {
+                uint32_t node { 0 };
+                for ( const char c : _lines[i] ) {
+                    if ( node = child(node, c); node == 0 ) { break; }
+                    for ( const auto& id : trie_[node].ends ) { hits[id].push_back(i); }
+                }
+            }
+            return hits;
+        }
+    };
+
+    /*
+    * Process-wide detector for the current config set, only rebuilt when
+    * a config is added, removed or changed.
+    */
+    inline std::shared_ptr<const config_detector>
+    shared_config_detector( const schema_map& _schemas ) {
+        static std::mutex detector_mtx;
+        static std::shared_ptr<const config_detector> detector;
+
+        const auto signature { config_detector::signature_of(_schemas) };
+
+        std::lock_guard lock { detector_mtx };
+        if ( !detector || detector->signature() != signature ) {
+            detector = std::make_shared<const config_detector>(_schemas);
+        }
+        return detector;
+    }
+} // NAMESPACE: burn_in_data_report
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <limits>
 #include <string>
 #include <exception>
 #include <sstream>
@@ -8,6 +12,7 @@
 
 #include "../S__Datastructures/BIDR_Settings.h"
 #include "BIDR_Regex.h"
+#include "BIDR_TimeParse.h"
 
 namespace burn_in_data_report
 {
@@ -143,6 +148,51 @@ namespace burn_in_data_report
         return std::string{ view.begin(), view.end() };
     }
 
+    // View without leading & ending whitespace, empty input gives an empty view
+    constexpr std::string_view
+    trim_view( std::string_view sv ) noexcept {
+        while ( !sv.empty() && is_whitespace(sv.front()) ) { sv.remove_prefix(1); }
+        while ( !sv.empty() && is_whitespace(sv.back()) ) { sv.remove_suffix(1); }
+        return sv;
+    }
+
+    /*
+    * Parses a numeric cell straight from the line with std::from_chars
+    * (locale independent, no copy). Surrounding whitespace & a leading '+'
+    * are skipped as sscanf would. Integer cells written with a fraction or
+    * exponent are read as doubles, the exponent applied ("1e3" -> 1000) &
+    * the fraction truncated toward zero, values outside T's range fail.
+    * Returns false, leaving _result unchanged, unless the whole cell is a
+    * number.
+    */
+    template <ArithmeticType T>
+    bool
+    parse_cell( const std::string_view _cell, T& _result ) noexcept {
+        const std::string_view cell { trim_view(_cell) };
+        const char* first { cell.data() };
+        const char* last { cell.data() + cell.size() };
+        if ( first != last && *first == '+' ) { ++first; }
+        if ( first == last ) { return false; }
+
+        T val {};
+        std::from_chars_result res { std::from_chars(first, last, val) };
+        if constexpr ( std::is_integral_v<T> ) {
+            if ( res.ec == std::errc {} && res.ptr != last && (*res.ptr == '.' || *res.ptr == 'e' || *res.ptr == 'E') ) {
+                double d {};
+                res = std::from_chars(first, last, d);
+                // Converting an out of range double is undefined, 2^digits is exact as a double
+                const double upper { std::ldexp(1.0, std::numeric_limits<T>::digits) };
+                const bool   in_range { std::is_signed_v<T> ? d >= -upper && d < upper : d > -1.0 && d < upper };
+                if ( !in_range ) { return false; }
+                val = static_cast<T>(d);
+            }
+        }
+        if ( res.ec != std::errc {} || res.ptr != last ) { return false; }
+
+        _result = val;
+        return true;
+    }
+
     // Parse a json file
     inline bool
     parse_json( const std::filesystem::path& _filePath, nlohmann::json& _dest ) {
@@ -159,11 +209,8 @@ namespace burn_in_data_report
 
     inline
     bool
-    text_to_lines( const std::string_view _text, std::vector<std::string_view>& _storage ) noexcept {
-        try {
-            std::string_view delim { "\n" };
-            _storage = split_str(_text, delim);
-        }
+    text_to_lines( const std::string_view _text, line_index& _storage ) noexcept {
+        try { _storage.build(_text); }
         catch ( const std::exception& err ) {
             write_err_log( err, "DLL: <text_to_lines>" );
             _storage.clear();
@@ -253,6 +300,23 @@ namespace burn_in_data_report
         return _default;
     }
 
+    // time_format with a compiled pattern, no stream or copy unless the pattern isn't supported
+    template <typename TimeType>
+    TimeType
+    time_format( const std::string_view _time_str, const time_parser& _parser, const TimeType& _default ) {
+        if ( !_parser.supported() ) { return time_format(std::string { _time_str }, _parser.pattern(), _default); }
+
+        int64_t ns { 0 };
+        if constexpr ( requires { typename TimeType::clock; } ) {
+            if ( !_parser.parse_time_point(_time_str, ns) ) { return _default; }
+            return TimeType { std::chrono::duration_cast<typename TimeType::duration>(nano { ns }) };
+        }
+        else {
+            if ( !_parser.parse_duration(_time_str, ns) ) { return _default; }
+            return std::chrono::duration_cast<TimeType>(nano { ns });
+        }
+    }
+
     template <typename TimeType>
     time_t
     time_to_time_t( const TimeType& _time ) {
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <bit>
+#include <string_view>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__x86_64__) || defined(__SSE2__)
+#define BIDR_LINE_INDEX_SSE2 1
+#include <emmintrin.h>
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define BIDR_TARGET_AVX2
+#else
+#include <cpuid.h>
+#define BIDR_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+#include "../BIDR_Defines.h"
+
+namespace burn_in_data_report
+{
+    /*
+    * Newline scanning for text_to_lines. Each kernel handles 16 (SSE2) or
+    * 32 (AVX2) bytes per step by comparing against '\n' & walking the set
+    * bits of the resulting mask, the tail is scanned byte by byte. AVX2 is
+    * chosen at runtime when both the CPU & OS support it.
+    */
+    namespace newline_scan
+    {
+        inline bool
+        has_avx2() noexcept {
+#if defined(BIDR_LINE_INDEX_SSE2)
+            static const bool supported {
+                [] {
+#if defined(_MSC_VER)
+                    int info[4];
+                    __cpuid(info, 0);
+                    if ( info[0] < 7 ) { return false; }
+                    __cpuid(info, 1);
+                    // OSXSAVE & AVX, then the OS must have enabled the YMM state
+                    if ( (info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 ) { return false; }
+                    if ( (_xgetbv(0) & 0x6) != 0x6 ) { return false; }
+                    __cpuidex(info, 7, 0);
+                    return (info[1] & (1 << 5)) != 0;
+#else
+                    __builtin_cpu_init();
+                    return __builtin_cpu_supports("avx2") != 0;
+#endif
+                }()
+            };
+            return supported;
+#else
+            return false;
+#endif
+        }
+
+        // Calls _f(pos) for each '\n' in [_pos, _size) of _data
+        template <typename F>
+        void
+        scalar( const char* _data, std::size_t _pos, const std::size_t _size, F&& _f ) {
+            for ( ; _pos < _size; ++_pos ) {
+                if ( _data[_pos] == '\n' ) { _f(_pos); }
+            }
+        }
+
+#if defined(BIDR_LINE_INDEX_SSE2)
+        template <typename F>
+        void
+        sse2( const char* _data, const std::size_t _size, F&& _f ) {
+            const __m128i newline { _mm_set1_epi8('\n') };
+            std::size_t pos { 0 };
+            for ( ; pos + 16 <= _size; pos += 16 ) {
+                const __m128i chunk { _mm_loadu_si128(reinterpret_cast<const __m128i*>(_data + pos)) };
+                auto mask { static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newline))) };
+                while ( mask != 0 ) {
+                    _f(pos + static_cast<std::size_t>(std::countr_zero(mask)));
+                    mask &= mask - 1;
+                }
+            }
+            scalar(_data, pos, _size, _f);
+        }
+
+        template <typename F>
+        BIDR_TARGET_AVX2 void
+        avx2( const char* _data, const std::size_t _size, F&& _f ) {
+            const __m256i newline { _mm256_set1_epi8('\n') };
+            std::size_t pos { 0 };
+            for ( ; pos + 32 <= _size; pos += 32 ) {
+                const __m256i chunk { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_data + pos)) };
+                auto mask { static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, newline))) };
+                while ( mask != 0 ) {
+                    _f(pos + static_cast<std::size_t>(std::countr_zero(mask)));
+                    mask &= mask - 1;
+                }
+            }
+            scalar(_data, pos, _size, _f);
+        }
+
+        inline std::size_t
+        count_sse2( const char* _data, const std::size_t _size ) noexcept {
+            const __m128i newline { _mm_set1_epi8('\n') };
+            std::size_t n { 0 }, pos { 0 };
+            for ( ; pos + 16 <= _size; pos += 16 ) {
+                const __m128i chunk { _mm_loadu_si128(reinterpret_cast<const __m128i*>(_data + pos)) };
+                n += static_cast<std::size_t>(
+                    std::popcount(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newline))))
+                );
+            }
+            scalar(_data, pos, _size, [&n]( std::size_t ) { ++n; });
+            return n;
+        }
+
+        BIDR_TARGET_AVX2 inline std::size_t
+        count_avx2( const char* _data, const std::size_t _size ) noexcept {
+            const __m256i newline { _mm256_set1_epi8('\n') };
+            std::size_t n { 0 }, pos { 0 };
+            for ( ; pos + 32 <= _size; pos += 32 ) {
+                const __m256i chunk { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_data + pos)) };
+                n += static_cast<std::size_t>(
+                    std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, newline))))
+                );
+            }
+            scalar(_data, pos, _size, [&n]( std::size_t ) { ++n; });
+            return n;
+        }
+#endif
+
+        // Number of '\n' in _text
+        inline std::size_t
+        count( const std::string_view _text ) noexcept {
+#if defined(BIDR_LINE_INDEX_SSE2)
+            return has_avx2()
+                       ? count_avx2(_text.data(), _text.size())
+                       : count_sse2(_text.data(), _text.size());
+#else
+            std::size_t n { 0 };
+            scalar(_text.data(), 0, _text.size(), [&n]( std::size_t ) { ++n; });
+            return n;
+#endif
+        }
+
+        // Calls _f(pos) for each '\n' in _text, in order
+        template <typename F>
+        void
+        for_each( const std::string_view _text, F&& _f ) {
+#if defined(BIDR_LINE_INDEX_SSE2)
+            if ( has_avx2() ) { avx2(_text.data(), _text.size(), _f); }
+            else { sse2(_text.data(), _text.size(), _f); }
+#else
+            scalar(_text.data(), 0, _text.size(), _f);
+#endif
+        }
+    } // NAMESPACE: newline_scan
+
+
+    /*
+    * Line offsets of a block of text, built by one vectorised scan. Each
+    * line costs a single uinteger: the position of the '\n' ending it, with
+    * the top bit set when the line ends in "\r\n" (found in the same pass).
+    *
+    * Lines match split_str(text, "\n"): empty lines are kept, a trailing
+    * line is only present if it isn't empty. operator[] returns the line as
+    * split_str did (a '\r' before the '\n' is kept, config regexes may rely
+    * on it), content() returns it without the '\r'.
+    */
+    class line_index
+    {
+    private:
+        static constexpr uinteger cr_flag { uinteger { 1 } << (sizeof(uinteger) * 8 - 1) };
+
+        std::string_view      text_;
+        std::vector<uinteger> ends_;
+
+        [[nodiscard]] uinteger start( const uinteger& _i ) const noexcept {
+            return _i == 0 ? 0 : (ends_[_i - 1] & ~cr_flag) + 1;
+        }
+
+    public:
+        line_index() noexcept = default;
+
+        explicit line_index( const std::string_view _text ) { build(_text); }
+
+        void
+        build( const std::string_view _text ) {
+            text_ = _text;
+            ends_.clear();
+            // Exact size up front, the count pass is far cheaper than regrowth
+            ends_.reserve(newline_scan::count(_text) + 1);
+
+            const char* data { _text.data() };
+            newline_scan::for_each(_text, [this, data]( const std::size_t _pos ) {
+                const bool cr { _pos > 0 && data[_pos - 1] == '\r' };
+                ends_.push_back(static_cast<uinteger>(_pos) | (cr ? cr_flag : 0));
+            });
+
+            // Unterminated final line, a lone trailing '\r' is still stripped by content()
+            const uinteger last_start { ends_.empty() ? 0 : (ends_.back() & ~cr_flag) + 1 };
+            if ( last_start < _text.size() ) {
+                const bool cr { _text.back() == '\r' };
+                ends_.push_back(static_cast<uinteger>(_text.size()) | (cr ? cr_flag : 0));
+            }
+        }
+
+        // Points the index at a copy of its text, e.g after the owning buffer was copied
+        void
+        rebase( const std::string_view _text ) noexcept { text_ = _text; }
+
+        // Frees the index, the text isn't owned
+        void
+        clear() noexcept {
+            text_ = std::string_view {};
+            ends_ = std::vector<uinteger> {};
+        }
+
+        [[nodiscard]] uinteger size() const noexcept { return static_cast<uinteger>(ends_.size()); }
+
+        [[nodiscard]] bool empty() const noexcept { return ends_.empty(); }
+
+        [[nodiscard]] std::string_view text() const noexcept { return text_; }
+
+        // Offset of line _i in text()
+        [[nodiscard]] uinteger offset( const uinteger& _i ) const noexcept { return start(_i); }
+
+        [[nodiscard]] std::string_view
+        operator[]( const uinteger& _i ) const noexcept {
+            const uinteger first { start(_i) };
+            return text_.substr(first, (ends_[_i] & ~cr_flag) - first);
+        }
+
+        [[nodiscard]] std::string_view
+        content( const uinteger& _i ) const noexcept {
+            const uinteger first { start(_i) };
+            const uinteger last { (ends_[_i] & ~cr_flag) - ((ends_[_i] & cr_flag) ? 1 : 0) };
+            return text_.substr(first, last - first);
+        }
+
+        // Bytes held by the index itself
+        [[nodiscard]] uinteger memory_usage() const noexcept {
+            return static_cast<uinteger>(ends_.capacity() * sizeof(uinteger));
+        }
+    };
+} // NAMESPACE: burn_in_data_report
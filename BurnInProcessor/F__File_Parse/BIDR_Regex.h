@@ -1,14 +1,99 @@
 #pragma once
 
+#include <cctype>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+
 #include "../BIDR_Defines.h"
+#include "BIDR_LineIndex.h"
 
 
 namespace burn_in_data_report
 {
+    /*
+    * Process-wide cache of compiled patterns keyed by pattern text, each
+    * pattern is compiled once however many configs / files / loads use it.
+    * Entries are never evicted, the returned reference stays valid for the
+    * life of the process. Throws std::regex_error for an invalid pattern.
+    */
+    inline const std::regex&
+    cached_regex( const std::string_view _pattern ) {
+        struct pattern_hash
+        {
+            using is_transparent = void;
+
+            std::size_t
+            operator()( const std::string_view _s ) const noexcept { return std::hash<std::string_view> {}(_s); }
+        };
+
+        static std::shared_mutex cache_mtx;
+        static std::unordered_map<std::string, std::unique_ptr<const std::regex>, pattern_hash, std::equal_to<>> cache;
+
+        {
+            std::shared_lock lock { cache_mtx };
+            if ( const auto iter { cache.find(_pattern) }; iter != cache.end() ) { return *iter->second; }
+        }
+
+        // Compiled outside the lock, if another thread got there first its pattern is kept
+        auto compiled { std::make_unique<const std::regex>(_pattern.data(), _pattern.size()) };
+        std::unique_lock lock { cache_mtx };
+        return *cache.try_emplace(std::string { _pattern }, std::move(compiled)).first->second;
+    }
+
+    /*
+    * Literal text every match of the ECMAScript _pattern starts with, e.g
+    * ";PC Software:StarLab Version 3.50 Build " for
+    * ";PC Software:StarLab Version 3\.50 Build [\d]+[\r\s]*". Reads plain &
+    * escaped literals up to the first other construct, a literal made
+    * optional by its quantifier is left out. Empty if the pattern has a
+    * top level alternative.
+    */
+    inline std::string
+    regex_literal_prefix( const std::string_view _pattern ) {
+        int  depth { 0 };
+        bool in_class { false };
+        for ( std::size_t i { 0 }; i < _pattern.size(); ++i ) {
+            const char c { _pattern[i] };
+            if ( c == '\\' ) { ++i; }
+            else if ( in_class ) { in_class = c != ']'; }
+            else if ( c == '[' ) { in_class = true; }
+            else if ( c == '(' ) { ++depth; }
+            else if ( c == ')' ) { --depth; }
+            else if ( c == '|' && depth == 0 ) { return {}; }
+        }
+
+        constexpr std::string_view special { "^$.*+?()[]{}|" };
+        std::string prefix;
+        std::size_t i { !_pattern.empty() && _pattern.front() == '^' ? std::size_t { 1 } : std::size_t { 0 } };
+        while ( i < _pattern.size() ) {
+            char        literal { _pattern[i] };
+            std::size_t next { i + 1 };
+            if ( literal == '\\' ) {
+                // Alphanumeric escapes are classes, anchors, back references or control chars
+                if ( next == _pattern.size() || std::isalnum(static_cast<unsigned char>(_pattern[next])) ) { break; }
+                literal = _pattern[next++];
+            }
+            else if ( special.find(literal) != std::string_view::npos ) { break; }
+
+            if ( next < _pattern.size() ) {
+                if ( const char q { _pattern[next] }; q == '*' || q == '?' || q == '{' ) { break; }
+                else if ( q == '+' ) {
+                    prefix += literal;
+                    break;
+                }
+            }
+            prefix += literal;
+            i = next;
+        }
+        return prefix;
+    }
+
     // -> bool: Returns if _pattern is found within _line
     inline bool
     line_check( const std::string_view& _line, const std::regex& _pattern ) noexcept {
-        try { return std::regex_match(std::string { _line }, _pattern); }
+        try { return std::regex_match(_line.data(), _line.data() + _line.size(), _pattern); }
         catch ( const std::exception& err ) {
             write_err_log( err, "DLL: <line_check>" );
             return false;
@@ -17,7 +102,7 @@ namespace burn_in_data_report
 
     // -> bool: Returns _pattern is found in any line in _data. Sets _lim to index of that line if found.
     inline bool
-    line_check( const std::vector<std::string_view>& _data,
+    line_check( const line_index&                    _data,
                const std::regex&                    _pattern,
                uinteger&                            _lim ) noexcept {
         try {
@@ -40,13 +125,10 @@ namespace burn_in_data_report
 
     // -> bool: Returns if _pattern_str is found on any line in _data. Sets _lim to index of that line if found.
     inline bool
-    line_check( const std::vector<std::string_view>& _data,
+    line_check( const line_index&                    _data,
                const std::string_view&              _pattern_str,
                uinteger&                            _lim ) noexcept {
-        try {
-            const auto pattern = std::regex(std::string { _pattern_str });
-            return line_check(_data, pattern, _lim);
-        }
+        try { return line_check(_data, cached_regex(_pattern_str), _lim); }
         catch ( const std::exception& err ) {
             write_err_log( err, "DLL: <line_check>" );
             return false;
@@ -60,9 +142,9 @@ namespace burn_in_data_report
         const std::regex&         _pattern
     ) noexcept {
         try {
-            std::smatch sm;
-            std::string text { _line };
-            if ( std::regex_match(text, sm, _pattern) ) {
+            // Matched in place, only the captures of a matching line are copied out
+            std::cmatch sm;
+            if ( std::regex_match(_line.data(), _line.data() + _line.size(), sm, _pattern) ) {
                 for ( auto& match : sm )
                     _matches.push_back(match.str());
                 return true;
@@ -77,7 +159,7 @@ namespace burn_in_data_report
 
     inline bool
     line_capture(
-        const std::vector<std::string_view>& _data,
+        const line_index&                    _data,
         std::vector<std::string>&            _matches,
         const std::regex&                    _pattern,
         const uinteger&                      _lim
@@ -98,15 +180,12 @@ namespace burn_in_data_report
 
     inline bool
     line_capture(
-        const std::vector<std::string_view>& _data,
+        const line_index&                    _data,
         std::vector<std::string>&            _matches,
         const std::string_view&              _pattern_str,
         const uinteger&                      _lim
     ) noexcept {
-        try {
-            auto pattern = std::regex(_pattern_str.data());
-            return line_capture(_data, _matches, pattern, _lim);
-        }
+        try { return line_capture(_data, _matches, cached_regex(_pattern_str), _lim); }
         catch ( const std::exception& err ) {
             write_err_log( err, "DLL: <line_capture>" );
             return false;
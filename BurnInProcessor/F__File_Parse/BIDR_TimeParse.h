@@ -0,0 +1,222 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../BIDR_Defines.h"
+
+namespace burn_in_data_report
+{
+    /*
+    * A config "time_pattern" compiled into a fixed list of fields, read
+    * straight from the text with no stream or allocation. Covers the
+    * chrono::parse flags our configs use: %Y %y %m %d %e %H %M %S (with
+    * fractional seconds) & the %F %T %R %D shorthands, literals, %%, %n
+    * (one whitespace), %t (zero or one) and whitespace (any amount, as
+    * from_stream). Patterns using other flags
+    * compile as unsupported, time_format falls back to from_stream for them.
+    */
+    class time_parser
+    {
+    private:
+        enum class field : uint8_t
+        {
+            literal,
+            space,
+            space_one, // %n
+            space_opt, // %t
+            year,
+            year2,
+            month,
+            day,
+            hour,
+            minute,
+            second
+        };
+
+        struct step
+        {
+            field kind;
+            char  c; // Literal char
+        };
+
+        std::string       pattern_ {};
+        std::vector<step> steps_ {};
+        bool              supported_ { false };
+        bool              has_date_ { false }; // Year, month & day all present
+        bool              any_date_ { false };
+
+        static bool
+        is_space( const char _c ) noexcept { return _c == ' ' || (_c >= '\t' && _c <= '\r'); }
+
+        // Reads 1 to _width digits at _pos
+        static bool
+        read_digits( const std::string_view _text, std::size_t& _pos, const std::size_t& _width,
+                     int64_t& _value ) noexcept {
+            const std::size_t first { _pos };
+            _value = 0;
+            while ( _pos < _text.size() && _pos - first < _width
+                    && _text[_pos] >= '0' && _text[_pos] <= '9' ) {
+                _value = _value * 10 + (_text[_pos++] - '0');
+            }
+            return _pos != first;
+        }
+
+        // Walks the steps over _text, _date_ns is the date as ns since epoch, _tod_ns the time of day
+        bool
+        scan( const std::string_view _text, int64_t& _date_ns, int64_t& _tod_ns ) const noexcept {
+            int64_t     y { 1970 }, mo { 1 }, d { 1 }, h { 0 }, mi { 0 }, s { 0 }, frac { 0 };
+            std::size_t pos { 0 };
+
+            for ( const auto& [kind, c] : steps_ ) {
+                switch ( kind ) {
+                case field::literal:
+                    if ( pos == _text.size() || _text[pos] != c ) { return false; }
+                    ++pos;
+                    break;
+                case field::space:
+                    while ( pos < _text.size() && is_space(_text[pos]) ) { ++pos; }
+                    break;
+                case field::space_one:
+                    if ( pos == _text.size() || !is_space(_text[pos]) ) { return false; }
+                    ++pos;
+                    break;
+                case field::space_opt:
+                    if ( pos < _text.size() && is_space(_text[pos]) ) { ++pos; }
+                    break;
+                case field::year:
+                    if ( !read_digits(_text, pos, 4, y) ) { return false; }
+                    break;
+                case field::year2:
+                    if ( !read_digits(_text, pos, 2, y) ) { return false; }
+                    y += y < 69 ? 2000 : 1900;
+                    break;
+                case field::month:
+                    if ( !read_digits(_text, pos, 2, mo) ) { return false; }
+                    break;
+                case field::day:
+                    if ( !read_digits(_text, pos, 2, d) ) { return false; }
+                    break;
+                case field::hour:
+                    if ( !read_digits(_text, pos, 2, h) || h > 23 ) { return false; }
+                    break;
+                case field::minute:
+                    if ( !read_digits(_text, pos, 2, mi) || mi > 59 ) { return false; }
+                    break;
+                case field::second:
+                    if ( !read_digits(_text, pos, 2, s) || s > 60 ) { return false; }
+                    // Fraction, to ns precision as from_stream into a nano duration
+                    if ( pos + 1 < _text.size() && _text[pos] == '.'
+                         && _text[pos + 1] >= '0' && _text[pos + 1] <= '9' ) {
+                        const std::size_t first { ++pos };
+                        if ( !read_digits(_text, pos, 9, frac) ) { return false; }
+                        for ( std::size_t n { pos - first }; n < 9; ++n ) { frac *= 10; }
+                    }
+                    break;
+                }
+            }
+
+            const std::chrono::year_month_day ymd {
+                std::chrono::year { static_cast<int>(y) }, std::chrono::month { static_cast<unsigned>(mo) },
+                std::chrono::day { static_cast<unsigned>(d) }
+            };
+            if ( !ymd.ok() ) { return false; }
+
+            _date_ns = std::chrono::duration_cast<nano>(std::chrono::sys_days { ymd }.time_since_epoch()).count();
+            _tod_ns = ((h * 60 + mi) * 60 + s) * 1'000'000'000 + frac;
+            return true;
+        }
+
+    public:
+        time_parser() noexcept = default;
+
+        explicit time_parser( const std::string_view _pattern ) :
+            pattern_(_pattern),
+            supported_(true) {
+            bool year { false }, month { false }, day { false };
+            const auto add =
+                [this]( const field _kind, const char _c = '\0' ) { steps_.push_back({ _kind, _c }); };
+
+            for ( std::size_t i { 0 }; i < _pattern.size(); ++i ) {
+                const char c { _pattern[i] };
+                if ( is_space(c) ) {
+                    add(field::space);
+                    continue;
+                }
+                if ( c != '%' ) {
+                    add(field::literal, c);
+                    continue;
+                }
+                if ( ++i == _pattern.size() ) {
+                    supported_ = false;
+                    break;
+                }
+
+                switch ( _pattern[i] ) {
+                case 'Y': add(field::year); year = true; break;
+                case 'y': add(field::year2); year = true; break;
+                case 'm': add(field::month); month = true; break;
+                case 'd':
+                case 'e': add(field::day); day = true; break;
+                case 'H': add(field::hour); break;
+                case 'M': add(field::minute); break;
+                case 'S': add(field::second); break;
+                case 'F': // %Y-%m-%d
+                    steps_.insert(steps_.end(), { step { field::year, 0 }, step { field::literal, '-' },
+                                                 step { field::month, 0 }, step { field::literal, '-' },
+                                                 step { field::day, 0 } });
+                    year = month = day = true;
+                    break;
+                case 'D': // %m/%d/%y
+                    steps_.insert(steps_.end(), { step { field::month, 0 }, step { field::literal, '/' },
+                                                 step { field::day, 0 }, step { field::literal, '/' },
+                                                 step { field::year2, 0 } });
+                    year = month = day = true;
+                    break;
+                case 'T': // %H:%M:%S
+                    steps_.insert(steps_.end(), { step { field::hour, 0 }, step { field::literal, ':' },
+                                                 step { field::minute, 0 }, step { field::literal, ':' },
+                                                 step { field::second, 0 } });
+                    break;
+                case 'R': // %H:%M
+                    steps_.insert(steps_.end(), { step { field::hour, 0 }, step { field::literal, ':' },
+                                                 step { field::minute, 0 } });
+                    break;
+                case 'n': add(field::space_one); break;
+                case 't': add(field::space_opt); break;
+                case '%': add(field::literal, '%'); break;
+                default: supported_ = false; break;
+                }
+            }
+
+            has_date_ = year && month && day;
+            any_date_ = year || month || day;
+        }
+
+        [[nodiscard]] const std::string& pattern() const noexcept { return pattern_; }
+
+        [[nodiscard]] bool supported() const noexcept { return supported_; }
+
+        [[nodiscard]] bool has_date() const noexcept { return has_date_; }
+
+        // Date & time in _text as ns since epoch, the pattern must hold a full date
+        bool
+        parse_time_point( const std::string_view _text, int64_t& _ns ) const noexcept {
+            int64_t date { 0 }, tod { 0 };
+            if ( !supported_ || !has_date_ || !scan(_text, date, tod) ) { return false; }
+            _ns = date + tod;
+            return true;
+        }
+
+        // Time in _text as a ns duration, e.g a "%H:%M:%S" measurement period
+        bool
+        parse_duration( const std::string_view _text, int64_t& _ns ) const noexcept {
+            int64_t date { 0 }, tod { 0 };
+            if ( !supported_ || any_date_ || !scan(_text, date, tod) ) { return false; }
+            _ns = tod;
+            return true;
+        }
+    };
+} // NAMESPACE: burn_in_data_report
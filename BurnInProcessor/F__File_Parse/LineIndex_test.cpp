@@ -0,0 +1,134 @@
+#include "BIDR_FileParse.h"
+#include "BIDR_LineIndex.h"
+
+#include <format>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace burn_in_data_report;
+
+/*
+* line_index must split text exactly as split_str(text, "\n") does: empty
+* lines kept, an empty trailing line dropped, '\r' left on the line with
+* content() stripping it. Each newline_scan kernel must find the same
+* newlines as the scalar scan, including around the 16 & 32 byte steps.
+*/
+
+uinteger n_failed { 0 };
+
+std::string
+escaped( const std::string_view _text ) {
+    std::string out;
+    for ( const char c : _text ) {
+        if ( c == '\n' ) { out += "\\n"; }
+        else if ( c == '\r' ) { out += "\\r"; }
+        else { out += c; }
+    }
+    return out;
+}
+
+void
+verify( const bool _ok, const std::string_view _text, const std::string& _what ) {
+    if ( _ok ) { return; }
+    ++n_failed;
+    std::cout << std::format("[Failure] \"{}\": {}\n", escaped(_text), _what);
+}
+
+std::vector<std::size_t>
+newlines_scalar( const std::string_view _text ) {
+    std::vector<std::size_t> pos;
+    newline_scan::scalar(_text.data(), 0, _text.size(), [&pos]( const std::size_t _p ) { pos.push_back(_p); });
+    return pos;
+}
+
+void
+check_text( const std::string& _text ) {
+    const std::string_view text { _text };
+    const line_index       lines { text };
+    const auto             expected { split_str(text, std::string_view { "\n" }) };
+
+    verify(lines.size() == expected.size(), text,
+           std::format("{} lines, split_str gives {}", lines.size(), expected.size()));
+    for ( uinteger i { 0 }; i < lines.size() && i < expected.size(); ++i ) {
+        verify(lines[i] == expected[i], text,
+               std::format("line {} \"{}\", split_str gives \"{}\"", i, escaped(lines[i]), escaped(expected[i])));
+        verify(lines.offset(i) == static_cast<uinteger>(expected[i].data() - text.data()), text,
+               std::format("line {} offset {}", i, lines.offset(i)));
+
+        std::string_view content { expected[i] };
+        if ( content.ends_with('\r') ) { content.remove_suffix(1); }
+        verify(lines.content(i) == content, text,
+               std::format("content {} \"{}\", expected \"{}\"", i, escaped(lines.content(i)), escaped(content)));
+    }
+
+    const auto scalar { newlines_scalar(text) };
+    verify(newline_scan::count(text) == scalar.size(), text, "newline_scan::count");
+
+#if defined(BIDR_LINE_INDEX_SSE2)
+    std::vector<std::size_t> simd;
+    newline_scan::sse2(text.data(), text.size(), [&simd]( const std::size_t _p ) { simd.push_back(_p); });
+    verify(simd == scalar, text, "sse2 newlines differ from scalar");
+    verify(newline_scan::count_sse2(text.data(), text.size()) == scalar.size(), text, "count_sse2");
+
+    if ( newline_scan::has_avx2() ) {
+        simd.clear();
+        newline_scan::avx2(text.data(), text.size(), [&simd]( const std::size_t _p ) { simd.push_back(_p); });
+        verify(simd == scalar, text, "avx2 newlines differ from scalar");
+        verify(newline_scan::count_avx2(text.data(), text.size()) == scalar.size(), text, "count_avx2");
+    }
+#endif
+}
+
+int
+main() {
+    uinteger n_texts { 0 };
+    const auto run = [&n_texts]( const std::string& _text ) {
+        check_text(_text);
+        ++n_texts;
+    };
+
+    // Empty lines, the dropped empty trailing line, CRLF & lone '\r'
+    for ( const std::string text : { "", "\n", "\n\n", "a", "a\n", "\na", "a\nb", "a\n\nb\n", "a\n\n\n",
+                                     "a\r\nb\r\n", "a\r\n\r\nb", "a\r\nb", "\r\n", "\r\n\r\n", "\r", "a\r",
+                                     "a\r\nb\r", "a\rb\n", "\r\r\n", "a\n\r" } ) {
+        run(text);
+    }
+
+    // One newline at every position, bare, after a '\r' & with a trailing '\r',
+    // across the SIMD steps & the scalar tail
+    for ( std::size_t len { 1 }; len <= 70; ++len ) {
+        for ( std::size_t pos { 0 }; pos < len; ++pos ) {
+            std::string text(len, 'x');
+            text[pos] = '\n';
+            run(text);
+            if ( pos > 0 ) {
+                text[pos - 1] = '\r';
+                run(text);
+            }
+            if ( pos + 1 < len ) {
+                text.back() = '\r';
+                run(text);
+            }
+        }
+        // Every byte a newline
+        run(std::string(len, '\n'));
+        run(std::string(len, 'x') + '\r');
+    }
+
+    // Random short lines, fixed seed so failures repeat
+    std::mt19937                    gen { 2023 };
+    std::uniform_int_distribution<> length { 0, 200 };
+    constexpr std::string_view      alphabet { "ab,.\r\n\n\n" };
+    std::uniform_int_distribution<> pick { 0, static_cast<int>(alphabet.size()) - 1 };
+    for ( int n { 0 }; n < 5000; ++n ) {
+        std::string text(static_cast<std::size_t>(length(gen)), ' ');
+        for ( auto& c : text ) { c = alphabet[static_cast<std::size_t>(pick(gen))]; }
+        run(text);
+    }
+
+    std::cout << std::format("{} texts, {} failure(s)\n", n_texts, n_failed);
+    return n_failed == 0 ? 0 : 1;
+}
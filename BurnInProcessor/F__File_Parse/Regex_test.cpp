@@ -0,0 +1,114 @@
+#include "BIDR_Regex.h"
+
+#include <format>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace burn_in_data_report;
+
+/*
+* regex_literal_prefix is used to skip lines before running the regex, so a
+* prefix that isn't shared by every match stops a config from ever
+* matching. Each case gives the expected prefix & lines the pattern
+* matches, each of which must start with the prefix.
+*/
+
+struct prefix_case
+{
+    std::string              pattern;
+    std::string              prefix;
+    std::vector<std::string> matching;
+};
+
+const std::vector<prefix_case> cases {
+    // Identifiers from the test configs
+    { R"(;PC Software:StarLab Version 3\.50 Build [\d]+[\r\s]*)", ";PC Software:StarLab Version 3.50 Build ",
+      { ";PC Software:StarLab Version 3.50 Build 12", ";PC Software:StarLab Version 3.50 Build 7\r" } },
+    { R"(;PC Software:StarLab Version 2\.40 Build [\d]+[\r\s]*)", ";PC Software:StarLab Version 2.40 Build ",
+      { ";PC Software:StarLab Version 2.40 Build 1 \r" } },
+    { R"(;PC Software:StarLab Version 3\.7[\d] Build [\d]+[\r\s]*)", ";PC Software:StarLab Version 3.7",
+      { ";PC Software:StarLab Version 3.70 Build 5", ";PC Software:StarLab Version 3.75 Build 15\r" } },
+    { R"(Data Point,Laser Power,Output Voltage,Output Current,Prism Lite PDOF 1,Thermistor 2,Thermistor 1[\r\s]*)",
+      "Data Point,Laser Power,Output Voltage,Output Current,Prism Lite PDOF 1,Thermistor 2,Thermistor 1",
+      { "Data Point,Laser Power,Output Voltage,Output Current,Prism Lite PDOF 1,Thermistor 2,Thermistor 1\r" } },
+    { R"(Fan_1\(pwm_act_1\),Fan_1\(temp_1_C\)[\s]*)", "Fan_1(pwm_act_1),Fan_1(temp_1_C)",
+      { "Fan_1(pwm_act_1),Fan_1(temp_1_C)", "Fan_1(pwm_act_1),Fan_1(temp_1_C)  " } },
+    { R"(Temperature Monitor 1 \(RAL LCMS\),Humidity Monitor[\r\s]*)", "Temperature Monitor 1 (RAL LCMS),Humidity Monitor",
+      { "Temperature Monitor 1 (RAL LCMS),Humidity Monitor\r" } },
+    { R"([\d]+\/[\d]+\/[\d]+ [\d]+:[\d]+[:\d]*,Laser Power,PDOF 1[\s]*)", "",
+      { "01/02/2023 10:15,Laser Power,PDOF 1", "1/2/23 9:05:30,Laser Power,PDOF 1 " } },
+    { R"([ \t]+Timestamp[ \t]+Channel A[ \t\r]+)", "", { " Timestamp\tChannel A\r", "\tTimestamp Channel A " } },
+    { "", "", { "" } },
+
+    // Anchors
+    { "^abc", "abc", { "abc" } },
+    { "^abc$", "abc", { "abc" } },
+    { "^", "", { "" } },
+    { "abc$", "abc", { "abc" } },
+    { R"(ab\bc)", "ab", {} },
+
+    // Quantifiers, an optional literal is left out, a repeated one kept once
+    { "ab*c", "a", { "ac", "abbc" } },
+    { "ab?c", "a", { "ac", "abc" } },
+    { "ab{0,2}c", "a", { "ac", "abbc" } },
+    { "ab+c", "ab", { "abc", "abbbc" } },
+    { "ab+?c", "ab", { "abc", "abbc" } },
+    { "a*bc", "", { "bc", "aabc" } },
+    { "a?", "", { "", "a" } },
+    { R"(a\.?b)", "a", { "ab", "a.b" } },
+    { R"(a\++b)", "a+", { "a+b", "a++b" } },
+
+    // Escapes, punctuation is literal, letters & digits are classes or references
+    { R"(a\.b\(c\)\[d\]\{e\}\|f\\g\/h\-)", R"(a.b(c)[d]{e}|f\g/h-)", { R"(a.b(c)[d]{e}|f\g/h-)" } },
+    { R"(ab\d+)", "ab", { "ab1", "ab123" } },
+    { R"(ab\s*c)", "ab", { "abc", "ab  c" } },
+    { R"(ab\tc)", "ab", { "ab\tc" } },
+    { R"((a)b\1)", "", { "aba" } },
+
+    // Other constructs end the prefix
+    { "ab.c", "ab", { "abxc", "ab.c" } },
+    { "ab[cd]e", "ab", { "abce", "abde" } },
+    { "ab[^c]", "ab", { "abd" } },
+    { "ab(cd)?e", "ab", { "abe", "abcde" } },
+    { "ab(?:cd)+", "ab", { "abcd", "abcdcd" } },
+    { "ab(c|d)e", "ab", { "abce", "abde" } },
+
+    // Top level alternatives have no common prefix, nested or escaped ones don't count
+    { "abc|abd", "", { "abc", "abd" } },
+    { "a|b", "", { "a", "b" } },
+    { "(a|b)c", "", { "ac", "bc" } },
+    { "x[|]y", "x", { "x|y" } },
+    { "x[\\]|]y", "x", { "x]y", "x|y" } },
+    { "x\\|y", "x|y", { "x|y" } },
+    { "x(a|b)|y", "", { "xa", "y" } },
+};
+
+int
+main() {
+    uinteger n_failed { 0 };
+    for ( const auto& [pattern, expected, matching] : cases ) {
+        const std::string prefix { regex_literal_prefix(pattern) };
+        if ( prefix != expected ) {
+            ++n_failed;
+            std::cout << std::format("[Failure] \"{}\" -> \"{}\", expected \"{}\".\n", pattern, prefix, expected);
+        }
+
+        const std::regex re { pattern };
+        for ( const auto& line : matching ) {
+            if ( !std::regex_match(line, re) ) {
+                ++n_failed;
+                std::cout << std::format("[Failure] \"{}\" doesn't match \"{}\".\n", pattern, line);
+            }
+            else if ( !line.starts_with(prefix) ) {
+                ++n_failed;
+                std::cout << std::format("[Failure] \"{}\" matches \"{}\", which doesn't start with \"{}\".\n",
+                                         pattern, line, prefix);
+            }
+        }
+    }
+
+    std::cout << std::format("{} patterns, {} failure(s)\n", cases.size(), n_failed);
+    return n_failed == 0 ? 0 : 1;
+}
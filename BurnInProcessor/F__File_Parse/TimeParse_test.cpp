@@ -0,0 +1,146 @@
+#include "BIDR_FileParse.h"
+#include "BIDR_TimeParse.h"
+
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace burn_in_data_report;
+using namespace std::chrono_literals;
+
+/*
+* time_parser replaces from_stream for the config time patterns, so both
+* time_format overloads must agree: same value, or both fall back to the
+* default. Each case also gives the expected value, nullopt if the text
+* must be rejected.
+*/
+
+using time_point = std::chrono::time_point<std::chrono::system_clock, nano>;
+
+struct time_case
+{
+    std::string         pattern;
+    std::string         input;
+    bool                duration; // Parsed to a nano duration rather than a time point
+    std::optional<nano> expected; // Time since epoch or the duration
+};
+
+constexpr std::chrono::sys_days day_0 { std::chrono::year { 2023 } / 3 / 5 };
+constexpr nano                  at_0 { day_0.time_since_epoch() + 14h + 7min + 9s };
+
+const std::vector<time_case> cases {
+    // Patterns from the test configs
+    { "%d/%m/%Y at %H:%M:%S", "05/03/2023 at 14:07:09", false, at_0 },
+    { "%d/%m/%Y at %H:%M:%S", "5/3/2023 at 4:07:09", false, at_0 - 10h },
+    { "%d/%m/%Y at %H:%M:%S", "05/03/2023 at 14:07:09\r", false, at_0 },
+    { "%d/%m/%Y at %H:%M:%S", "05/03/2023 14:07:09", false, std::nullopt },
+    { "%d_%m_%Y_%H_%M_%S", "05_03_2023_14_07_09", false, at_0 },
+    { "%d_%m_%Y_%H_%M_%S", "05_03_2023_14_07", false, std::nullopt },
+    { "%m/%d/%Y %H:%M:%S AM", "03/05/2023 02:07:09 AM", false, at_0 - 12h },
+    { "%d/%m/%Y %H:%M", "05/03/2023 14:07", false, at_0 - 9s },
+    { "%d/%m/%Y %H:%M", "05/03/2023 14:07:09", false, at_0 - 9s },
+    { "%H:%M:%S", "00:00:10", true, nano { 10s } },
+    { "%H:%M:%S", "01:30:00", true, nano { 1h + 30min } },
+    { "%H:%M:%S", "23:59:59", true, nano { 24h - 1s } },
+    { "%H:%M:%S", "00:00:00.25", true, nano { 250ms } },
+    { "%H:%M:%S", "00:01", true, std::nullopt },
+
+    // Shorthands
+    { "%F %T", "2023-03-05 14:07:09", false, at_0 },
+    { "%F %T", "2023-03-05 14:07", false, std::nullopt },
+    { "%F %R", "2023-03-05 14:07", false, at_0 - 9s },
+    { "%D %T", "03/05/23 14:07:09", false, at_0 },
+    { "%D %T", "03/05/99 14:07:09", false, at_0 - (day_0 - std::chrono::sys_days { std::chrono::year { 1999 } / 3 / 5 }) },
+    { "%D %T", "03/05/68 14:07:09", false, at_0 + (std::chrono::sys_days { std::chrono::year { 2068 } / 3 / 5 } - day_0) },
+    { "%D %T", "03/05/69 14:07:09", false, at_0 - (day_0 - std::chrono::sys_days { std::chrono::year { 1969 } / 3 / 5 }) },
+    { "%Y-%m-%e %H:%M:%S", "2023-03-5 14:07:09", false, at_0 },
+
+    // Fractional seconds
+    { "%F %T", "2023-03-05 14:07:09.5", false, at_0 + 500ms },
+    { "%F %T", "2023-03-05 14:07:09.123456789", false, at_0 + 123456789ns },
+    { "%F %T", "2023-03-05 14:07:09.000001", false, at_0 + 1us },
+
+    // Whitespace in the pattern matches any amount, %n exactly one & %t at most one
+    { "%F %T", "2023-03-05    14:07:09", false, at_0 },
+    { "%F %T", "2023-03-05\t14:07:09", false, at_0 },
+    { "%F%n%T", "2023-03-05 14:07:09", false, at_0 },
+    { "%F%n%T", "2023-03-05  14:07:09", false, std::nullopt },
+    { "%F%n%T", "2023-03-0514:07:09", false, std::nullopt },
+    { "%F%t%T", "2023-03-0514:07:09", false, at_0 },
+    { "%F%t%T", "2023-03-05 14:07:09", false, at_0 },
+    { "%F%t%T", "2023-03-05  14:07:09", false, std::nullopt },
+
+    // Literals & text after the pattern
+    { "%Y%%%m%%%d %T", "2023%03%05 14:07:09", false, at_0 },
+    { "[%F %T]", "[2023-03-05 14:07:09]", false, at_0 },
+    { "[%F %T]", "2023-03-05 14:07:09]", false, std::nullopt },
+    { "%F %T", "2023-03-05 14:07:09 trailing", false, at_0 },
+
+    // Out of range or malformed fields
+    { "%F %T", "2023-13-05 14:07:09", false, std::nullopt },
+    { "%F %T", "2023-00-05 14:07:09", false, std::nullopt },
+    { "%F %T", "2023-03-32 14:07:09", false, std::nullopt },
+    { "%F %T", "2023-02-29 14:07:09", false, std::nullopt },
+    { "%F %T", "2024-02-29 14:07:09", false, nano { std::chrono::sys_days { std::chrono::year { 2024 } / 2 / 29 }.time_since_epoch() + 14h + 7min + 9s } },
+    { "%F %T", "2023-03-05 24:00:00", false, std::nullopt },
+    { "%F %T", "2023-03-05 14:60:00", false, std::nullopt },
+    { "%F %T", "2023-0a-05 14:07:09", false, std::nullopt },
+    { "%F %T", "", false, std::nullopt },
+    { "%H:%M:%S", "", true, std::nullopt },
+    { "%H:%M:%S", "xx:00:10", true, std::nullopt },
+};
+
+template <typename T>
+std::string
+shown( const T& _value, const T& _default ) {
+    if ( _value == _default ) { return "default"; }
+    if constexpr ( requires { _value.time_since_epoch(); } ) {
+        return std::format("{}ns", _value.time_since_epoch().count());
+    }
+    else { return std::format("{}ns", _value.count()); }
+}
+
+int
+main() {
+    uinteger   n_failed { 0 };
+    const auto fail = [&n_failed]( const time_case& _case, const std::string& _what ) {
+        ++n_failed;
+        std::cout << std::format("[Failure] \"{}\" <- \"{}\": {}\n", _case.pattern, _case.input, _what);
+    };
+
+    for ( const auto& test : cases ) {
+        const time_parser parser { test.pattern };
+        if ( !parser.supported() ) { fail(test, "pattern not supported by time_parser"); }
+
+        if ( test.duration ) {
+            const nano none { nano::min() };
+            const nano parsed { time_format(std::string_view { test.input }, parser, none) };
+            const nano streamed { time_format(test.input, test.pattern, none) };
+            const nano expected { test.expected.value_or(none) };
+            if ( parsed != streamed ) {
+                fail(test, std::format("time_parser {}, from_stream {}", shown(parsed, none), shown(streamed, none)));
+            }
+            if ( parsed != expected ) {
+                fail(test, std::format("time_parser {}, expected {}", shown(parsed, none), shown(expected, none)));
+            }
+        }
+        else {
+            const time_point none { nano::min() };
+            const time_point parsed { time_format(std::string_view { test.input }, parser, none) };
+            const time_point streamed { time_format(test.input, test.pattern, none) };
+            const time_point expected { test.expected ? time_point { *test.expected } : none };
+            if ( parsed != streamed ) {
+                fail(test, std::format("time_parser {}, from_stream {}", shown(parsed, none), shown(streamed, none)));
+            }
+            if ( parsed != expected ) {
+                fail(test, std::format("time_parser {}, expected {}", shown(parsed, none), shown(expected, none)));
+            }
+        }
+    }
+
+    std::cout << std::format("{} cases, {} failure(s)\n", cases.size(), n_failed);
+    return n_failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,711 @@
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sqlite3.h>
+
+#include "../BIDR_Defines.h"
+#include "../S__Spreadsheet_Classes/BIDR_Spreadsheet.h"
+
+namespace burn_in_data_report
+{
+    /*
+    * Local SQLite store for processed burn-in runs.
+    *
+    * Schema:
+    * - runs:          one row per stored dataset (run_id, creation time, size).
+    * - run_files:     per file metadata from file_settings & file_boundary_t.
+    * - "<config>":    one table per config type holding the rows of every
+    *                  file which matched it: run_id, row_idx (row in the
+    *                  combined data), internal_time_ns, then the config's
+    *                  columns. Columns are added as configs gain them.
+    *                  Data without per file settings (open_data, sql_load)
+    *                  is stored in "external" with its combined columns.
+    * - cycle_results: cycle averaged values & errors of a spreadsheet's
+    *                  loaded columns, one row per (run, column, cycle).
+    *
+    * The database is opened in WAL mode, each store runs in a single
+    * transaction through prepared statements which are re-used per row.
+    */
+    inline constexpr std::string_view sql_schema {
+        "CREATE TABLE IF NOT EXISTS runs ("
+        " run_id INTEGER PRIMARY KEY AUTOINCREMENT,"
+        " created_ns INTEGER NOT NULL,"
+        " n_rows INTEGER NOT NULL,"
+        " n_files INTEGER NOT NULL);"
+        "CREATE TABLE IF NOT EXISTS run_files ("
+        " run_id INTEGER NOT NULL REFERENCES runs(run_id) ON DELETE CASCADE,"
+        " file_index INTEGER NOT NULL,"
+        " file_name TEXT NOT NULL,"
+        " config TEXT NOT NULL,"
+        " start_time_ns INTEGER NOT NULL,"
+        " internal_time_ns INTEGER NOT NULL,"
+        " last_write_ns INTEGER NOT NULL,"
+        " measurement_period_ns INTEGER NOT NULL,"
+        " row_offset INTEGER NOT NULL,"
+        " n_rows INTEGER NOT NULL,"
+        " n_cols INTEGER NOT NULL,"
+        " header_lim INTEGER NOT NULL,"
+        " data_pos INTEGER NOT NULL,"
+        " PRIMARY KEY (run_id, file_index));"
+        "CREATE TABLE IF NOT EXISTS cycle_results ("
+        " run_id INTEGER NOT NULL REFERENCES runs(run_id) ON DELETE CASCADE,"
+        " col TEXT NOT NULL,"
+        " cycle INTEGER NOT NULL,"
+        " value REAL,"
+        " text TEXT,"
+        " error REAL,"
+        " PRIMARY KEY (run_id, col, cycle));"
+    };
+
+    // Table for data without per file settings
+    inline constexpr std::string_view external_table { "external" };
+
+    // Quoted SQL identifier, e.g config & column names
+    inline std::string
+    sql_identifier( const std::string_view _name ) {
+        std::string result { "\"" };
+        for ( const char c : _name ) {
+            if ( c == '"' ) { result += '"'; }
+            result += c;
+        }
+        result += '"';
+        return result;
+    }
+
+    inline std::string_view
+    sql_type( const DataType& _type ) noexcept {
+        switch ( _type ) {
+        case DataType::INTEGER: return "INTEGER";
+        case DataType::DOUBLE: return "REAL";
+        case DataType::STRING: return "TEXT";
+        case DataType::NONE: break;
+        }
+        return "";
+    }
+
+
+    class sql_statement
+    {
+    private:
+        sqlite3*      db_;
+        sqlite3_stmt* stmt_;
+
+        void check( const int _rc ) const {
+            if ( _rc != SQLITE_OK ) {
+                throw std::runtime_error(std::format("<sql_statement> {}", sqlite3_errmsg(db_)));
+            }
+        }
+
+    public:
+        sql_statement( sqlite3* _db, const std::string_view _sql ) :
+            db_ { _db },
+            stmt_ { nullptr } {
+            check(sqlite3_prepare_v2(db_, _sql.data(), static_cast<int>(_sql.size()), &stmt_, nullptr));
+        }
+
+        ~sql_statement() { sqlite3_finalize(stmt_); }
+
+        sql_statement( const sql_statement& _other ) = delete;
+        sql_statement& operator=( const sql_statement& _other ) = delete;
+
+        sql_statement( sql_statement&& _other ) noexcept :
+            db_ { _other.db_ },
+            stmt_ { std::exchange(_other.stmt_, nullptr) } {}
+
+        // Parameters are 1 based
+        void bind( const int _idx, const integer& _val ) { check(sqlite3_bind_int64(stmt_, _idx, _val)); }
+
+        void bind( const int _idx, const double& _val ) {
+            check(std::isnan(_val) ? sqlite3_bind_null(stmt_, _idx) : sqlite3_bind_double(stmt_, _idx, _val));
+        }
+
+        void bind( const int _idx, const std::string_view _val ) {
+            check(sqlite3_bind_text(stmt_, _idx, _val.data(), static_cast<int>(_val.size()), SQLITE_STATIC));
+        }
+
+        void bind_null( const int _idx ) { check(sqlite3_bind_null(stmt_, _idx)); }
+
+        // true while rows are returned, false once done
+        bool step() {
+            const int rc { sqlite3_step(stmt_) };
+            if ( rc == SQLITE_ROW ) { return true; }
+            if ( rc == SQLITE_DONE ) { return false; }
+            throw std::runtime_error(std::format("<sql_statement::step> {}", sqlite3_errmsg(db_)));
+        }
+
+        void reset() {
+            sqlite3_reset(stmt_);
+            sqlite3_clear_bindings(stmt_);
+        }
+
+        // Result columns are 0 based
+        [[nodiscard]] int columns() const noexcept { return sqlite3_column_count(stmt_); }
+
+        [[nodiscard]] std::string_view name( const int _col ) const noexcept { return sqlite3_column_name(stmt_, _col); }
+
+        // Declared type of a table column, empty for expressions
+        [[nodiscard]] std::string_view declared_type( const int _col ) const noexcept {
+            const char* type { sqlite3_column_decltype(stmt_, _col) };
+            return type ? std::string_view { type } : std::string_view {};
+        }
+
+        [[nodiscard]] int type( const int _col ) const noexcept { return sqlite3_column_type(stmt_, _col); }
+
+        [[nodiscard]] integer get_i( const int _col ) const noexcept { return sqlite3_column_int64(stmt_, _col); }
+
+        [[nodiscard]] double get_d( const int _col ) const noexcept {
+            return type(_col) == SQLITE_NULL
+                       ? std::numeric_limits<double>::quiet_NaN()
+                       : sqlite3_column_double(stmt_, _col);
+        }
+
+        [[nodiscard]] std::string_view get_s( const int _col ) const noexcept {
+            const auto* text { reinterpret_cast<const char*>(sqlite3_column_text(stmt_, _col)) };
+            return text
+                       ? std::string_view { text, static_cast<std::size_t>(sqlite3_column_bytes(stmt_, _col)) }
+                       : std::string_view {};
+        }
+    };
+
+
+    class sql_database
+    {
+    private:
+        sqlite3* db_;
+
+        void
+        exec( const std::string& _sql ) const;
+
+        // Creates the table for _config or adds any of _cols it's missing
+        void
+        prepare_table( const std::string& _config, const TypeMap& _cols ) const;
+
+        // Loads run_files for _run_id, sorted by row_offset
+        [[nodiscard]] std::vector<file_boundary_t>
+        run_boundaries( const integer& _run_id ) const;
+
+        // Runs _body in a single transaction, rolled back if it throws
+        template <typename F>
+        void
+        transaction( const F& _body ) const;
+
+        // Columns of each table _data is stored to, paged in. Throws if there's nothing to store.
+        [[nodiscard]] static std::map<std::string, TypeMap>
+        store_tables( file_data& _data );
+
+        // Inserts _data as a new run into _tables (from store_tables), returns its run_id
+        integer
+        insert_run( const file_data& _data, const std::map<std::string, TypeMap>& _tables ) const;
+
+        void
+        insert_results( const integer& _run_id, const spreadsheet& _sheet ) const;
+
+    public:
+        explicit sql_database( const std::filesystem::path& _path );
+        ~sql_database() { sqlite3_close_v2(db_); }
+
+        sql_database( const sql_database& _other ) = delete;
+        sql_database& operator=( const sql_database& _other ) = delete;
+
+        /*
+        * Stores the combined data of _data as a new run, _run_id receives its
+        * id. Columns of data opened from a column store are paged in first.
+        */
+        bool
+        store( file_data& _data, integer& _run_id ) noexcept;
+
+        // Stores _sheet's file data & results (store_results) as a new run, in one transaction
+        bool
+        store( spreadsheet& _sheet, integer& _run_id ) noexcept;
+
+        // Stores the (cycle averaged) loaded columns of _sheet against an existing run
+        bool
+        store_results( const integer& _run_id, const spreadsheet& _sheet ) noexcept;
+
+        /*
+        * Runs _query & replaces the contents of _sheet with the result.
+        * - internal_time_ns, if selected, is used as the internal time base
+        *   (otherwise rows are 1s apart) & isn't added as a column.
+        * - If run_id & row_idx are both selected, file boundaries are
+        *   restored from run_files.
+        * e.g. SELECT * FROM "Config" WHERE run_id = 3 ORDER BY row_idx
+        */
+        bool
+        load( const std::string& _query, spreadsheet& _sheet ) noexcept;
+    };
+
+
+    inline
+    sql_database::sql_database( const std::filesystem::path& _path ) :
+        db_ { nullptr } {
+        if ( sqlite3_open_v2(_path.string().c_str(), &db_,
+                             SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr) != SQLITE_OK ) {
+            const std::string msg { db_ ? sqlite3_errmsg(db_) : "out of memory" };
+            sqlite3_close_v2(db_);
+            throw std::runtime_error(std::format("Failed to open database {}: {}", _path.string(), msg));
+        }
+
+        exec("PRAGMA journal_mode = WAL;"
+             "PRAGMA synchronous = NORMAL;"
+             "PRAGMA foreign_keys = ON;"
+             "PRAGMA temp_store = MEMORY;"
+             "PRAGMA cache_size = -65536;");
+        exec(std::string { sql_schema });
+    }
+
+    inline void
+    sql_database::exec( const std::string& _sql ) const {
+        char* err { nullptr };
+        if ( sqlite3_exec(db_, _sql.c_str(), nullptr, nullptr, &err) != SQLITE_OK ) {
+            const std::string msg { err ? err : sqlite3_errmsg(db_) };
+            sqlite3_free(err);
+            throw std::runtime_error(std::format("<sql_database::exec> {}", msg));
+        }
+    }
+
+    inline void
+    sql_database::prepare_table( const std::string& _config, const TypeMap& _cols ) const {
+        const auto table { sql_identifier(_config) };
+        exec(std::format("CREATE TABLE IF NOT EXISTS {} ("
+                         " run_id INTEGER NOT NULL REFERENCES runs(run_id) ON DELETE CASCADE,"
+                         " row_idx INTEGER NOT NULL,"
+                         " internal_time_ns INTEGER NOT NULL,"
+                         " PRIMARY KEY (run_id, row_idx));", table));
+
+        std::set<std::string> existing;
+        sql_statement info { db_, std::format("PRAGMA table_info({});", table) };
+        while ( info.step() ) { existing.emplace(info.get_s(1)); }
+
+        for ( const auto& [key, type] : _cols ) {
+            if ( existing.contains(key) ) { continue; }
+            exec(std::format("ALTER TABLE {} ADD COLUMN {} {};", table, sql_identifier(key), sql_type(type)));
+        }
+    }
+
+    template <typename F>
+    void
+    sql_database::transaction( const F& _body ) const {
+        exec("BEGIN IMMEDIATE;");
+        try {
+            _body();
+            exec("COMMIT;");
+        }
+        catch ( ... ) {
+            sqlite3_exec(db_, "ROLLBACK;", nullptr, nullptr, nullptr);
+            throw;
+        }
+    }
+
+    inline std::map<std::string, TypeMap>
+    sql_database::store_tables( file_data& _data ) {
+        const auto& settings { _data.get_file_settings() };
+        const auto  page_in =
+            [&_data]( const std::string& _key ) {
+            if ( !_data.page_in(_key) ) { throw std::runtime_error(std::format("Failed to page in {}.", _key)); }
+        };
+
+        if ( _data.get_internal_time_nanoseconds().empty() ) { throw std::runtime_error("No data to store."); }
+
+        // Columns of each config, in a fixed order per table
+        std::map<std::string, TypeMap> tables;
+        if ( settings.empty() ) {
+            // Opened (open_data) or queried (sql_load) data has no per file settings, store its combined columns
+            auto& cols { tables[std::string { external_table }] };
+            for ( const auto& [key, type] : _data.get_col_types() ) {
+                if ( type == DataType::NONE || key == "Combined Time" ) { continue; }
+                cols[key] = type;
+                page_in(key);
+            }
+            if ( cols.empty() ) { throw std::runtime_error("No columns to store."); }
+            return tables;
+        }
+
+        for ( const auto& boundary : _data.get_file_boundaries() ) {
+            const auto& file { settings.at(static_cast<uinteger>(boundary.index)) };
+            auto& cols { tables[file.get_schema().name] };
+            for ( const auto& [key, type] : file.get_col_types() ) {
+                if ( type == DataType::NONE ) { continue; }
+                cols[key] = type;
+                page_in(key);
+            }
+        }
+        if ( tables.empty() ) {
+            throw std::runtime_error("Cannot store data without file boundaries for its file settings.");
+        }
+        return tables;
+    }
+
+    inline integer
+    sql_database::insert_run( const file_data& _data, const std::map<std::string, TypeMap>& _tables ) const {
+        const auto& settings { _data.get_file_settings() };
+        const auto& boundaries { _data.get_file_boundaries() };
+        const auto& internal_time { _data.get_internal_time_nanoseconds() };
+
+        for ( const auto& [config, cols] : _tables ) { prepare_table(config, cols); }
+
+        integer run_id { -1 };
+        {
+            sql_statement run {
+                db_, "INSERT INTO runs (created_ns, n_rows, n_files) VALUES (?, ?, ?);"
+            };
+            run.bind(1, static_cast<integer>(std::chrono::system_clock::now().time_since_epoch().count()));
+            run.bind(2, static_cast<integer>(internal_time.size()));
+            run.bind(3, static_cast<integer>(boundaries.size()));
+            run.step();
+            run_id = sqlite3_last_insert_rowid(db_);
+        }
+
+        sql_statement file_insert {
+            db_,
+            "INSERT INTO run_files (run_id, file_index, file_name, config, start_time_ns, internal_time_ns,"
+            " last_write_ns, measurement_period_ns, row_offset, n_rows, n_cols, header_lim, data_pos)"
+            " VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"
+        };
+
+        std::map<std::string, sql_statement> row_inserts;
+        for ( const auto& [config, cols] : _tables ) {
+            std::string names { "run_id, row_idx, internal_time_ns" };
+            std::string params { "?, ?, ?" };
+            for ( const auto& [key, type] : cols ) {
+                names += ", " + sql_identifier(key);
+                params += ", ?";
+            }
+            row_inserts.emplace(config, sql_statement {
+                db_, std::format("INSERT INTO {} ({}) VALUES ({});", sql_identifier(config), names, params)
+            });
+        }
+
+        const auto& columns { _data.columns() };
+        const auto  insert_rows =
+            [&]( const std::string& _config, const uinteger& _first, const uinteger& _n ) {
+            // Resolve each column's storage once per file, not per row
+            std::vector<std::pair<DataType, const void*>> sources;
+            for ( const auto& [key, type] : _tables.at(_config) ) {
+                const column_id id { column_ids::find(key) };
+                switch ( type ) {
+                case DataType::INTEGER: sources.emplace_back(type, &columns.get<integer>(id)); break;
+                case DataType::DOUBLE: sources.emplace_back(type, &columns.get<double>(id)); break;
+                case DataType::STRING: sources.emplace_back(type, &columns.get<std::string>(id)); break;
+                case DataType::NONE: break;
+                }
+            }
+
+            auto& insert { row_inserts.at(_config) };
+            for ( uinteger row { _first }; row < _first + _n; ++row ) {
+                insert.bind(1, run_id);
+                insert.bind(2, static_cast<integer>(row));
+                insert.bind(3, static_cast<integer>(internal_time.at(row).count()));
+                int param { 4 };
+                for ( const auto& [type, source] : sources ) {
+                    switch ( type ) {
+                    case DataType::INTEGER:
+                        insert.bind(param, static_cast<const std::vector<integer>*>(source)->at(row));
+                        break;
+                    case DataType::DOUBLE:
+                        insert.bind(param, static_cast<const std::vector<double>*>(source)->at(row));
+                        break;
+                    case DataType::STRING:
+                        insert.bind(param, static_cast<const string_column*>(source)->at(row));
+                        break;
+                    case DataType::NONE: break;
+                    }
+                    ++param;
+                }
+                insert.step();
+                insert.reset();
+            }
+        };
+
+        // Without file settings, boundaries only give each file's name, start & rows
+        const std::string external { external_table };
+        const auto n_external_cols {
+            static_cast<integer>(settings.empty() ? _tables.at(external).size() : 0)
+        };
+
+        for ( const auto& [i, boundary] : enumerate(boundaries) ) {
+            const file_settings* file {
+                settings.empty() ? nullptr : &settings.at(static_cast<uinteger>(boundary.index))
+            };
+            const auto& config { file ? file->get_schema().name : external };
+
+            file_insert.bind(1, run_id);
+            file_insert.bind(2, static_cast<integer>(i));
+            file_insert.bind(3, std::string_view { boundary.file_name });
+            file_insert.bind(4, std::string_view { config });
+            file_insert.bind(5, static_cast<integer>(boundary.start_time.time_since_epoch().count()));
+            file_insert.bind(6, static_cast<integer>(boundary.internal_time.count()));
+            file_insert.bind(7, file ? static_cast<integer>(file->get_last_write().time_since_epoch().count()) : 0);
+            file_insert.bind(8, file ? static_cast<integer>(file->get_measurement_period().count()) : 0);
+            file_insert.bind(9, static_cast<integer>(boundary.row_offset));
+            file_insert.bind(10, static_cast<integer>(boundary.n_rows));
+            file_insert.bind(11, file ? static_cast<integer>(file->get_n_cols()) : n_external_cols);
+            file_insert.bind(12, file ? static_cast<integer>(file->get_header_lim()) : 0);
+            file_insert.bind(13, file ? static_cast<integer>(file->get_data_pos()) : 0);
+            file_insert.step();
+            file_insert.reset();
+
+            insert_rows(config, boundary.row_offset, boundary.n_rows);
+        }
+
+        // No boundaries (e.g a query without run_id & row_idx), every row goes to the external table
+        if ( boundaries.empty() ) { insert_rows(external, 0, static_cast<uinteger>(internal_time.size())); }
+
+        return run_id;
+    }
+
+    inline void
+    sql_database::insert_results( const integer& _run_id, const spreadsheet& _sheet ) const {
+        sql_statement insert {
+            db_,
+            "INSERT OR REPLACE INTO cycle_results (run_id, col, cycle, value, text, error)"
+            " VALUES (?, ?, ?, ?, ?, ?);"
+        };
+
+        // Values are read through views, nothing is copied out of the spreadsheet
+        for ( const auto& key : _sheet.get_current_cols() ) {
+            const auto type { _sheet.type(key) };
+            const auto errors { _sheet.view_error(key).rows() };
+            uinteger   cycle { 0 };
+            const auto store_row =
+                [&]( const auto& _bind_value ) {
+                insert.bind(1, _run_id);
+                insert.bind(2, std::string_view { key });
+                insert.bind(3, static_cast<integer>(cycle));
+                _bind_value();
+                if ( cycle < errors.size() ) { insert.bind(6, errors[cycle]); }
+                insert.step();
+                insert.reset();
+                ++cycle;
+            };
+
+            switch ( type ) {
+            case DataType::INTEGER:
+                _sheet.view<integer>(key).for_each([&]( const integer& _value ) {
+                    store_row([&] { insert.bind(4, static_cast<double>(_value)); });
+                });
+                break;
+            case DataType::DOUBLE:
+                _sheet.view<double>(key).for_each([&]( const double& _value ) {
+                    store_row([&] { insert.bind(4, _value); });
+                });
+                break;
+            case DataType::STRING:
+                _sheet.view<std::string>(key).for_each([&]( const std::string_view _value ) {
+                    store_row([&] { insert.bind(5, _value); });
+                });
+                break;
+            case DataType::NONE: break;
+            }
+        }
+    }
+
+    inline bool
+    sql_database::store( file_data& _data, integer& _run_id ) noexcept {
+        try {
+            const Timer t;
+            const auto  tables { store_tables(_data) };
+            transaction([&] { _run_id = insert_run(_data, tables); });
+
+            write_log(std::format("Stored run {} ({} rows), {}s.",
+                                  _run_id, _data.get_internal_time_nanoseconds().size(), t.elapsed()));
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <sql_database::store>");
+            return false;
+        }
+    }
+
+    inline bool
+    sql_database::store( spreadsheet& _sheet, integer& _run_id ) noexcept {
+        try {
+            const Timer t;
+            auto&       data { _sheet.get_file_data() };
+            const auto  tables { store_tables(data) };
+            transaction([&] {
+                _run_id = insert_run(data, tables);
+                insert_results(_run_id, _sheet);
+            });
+
+            write_log(std::format("Stored run {} ({} rows) & results, {}s.",
+                                  _run_id, data.get_internal_time_nanoseconds().size(), t.elapsed()));
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <sql_database::store>");
+            return false;
+        }
+    }
+
+    inline bool
+    sql_database::store_results( const integer& _run_id, const spreadsheet& _sheet ) noexcept {
+        try {
+            transaction([&] { insert_results(_run_id, _sheet); });
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <sql_database::store_results>");
+            return false;
+        }
+    }
+
+    inline std::vector<file_boundary_t>
+    sql_database::run_boundaries( const integer& _run_id ) const {
+        std::vector<file_boundary_t> result;
+        sql_statement query {
+            db_,
+            "SELECT file_index, file_name, start_time_ns, row_offset, n_rows"
+            " FROM run_files WHERE run_id = ? ORDER BY row_offset;"
+        };
+        query.bind(1, _run_id);
+        while ( query.step() ) {
+            file_boundary_t boundary;
+            boundary.index = query.get_i(0);
+            boundary.file_name = std::string { query.get_s(1) };
+            boundary.internal_time = nano::zero();
+            boundary.start_time = file_boundary_t::timepoint { nano { query.get_i(2) } };
+            boundary.row_offset = static_cast<uinteger>(query.get_i(3));
+            boundary.n_rows = static_cast<uinteger>(query.get_i(4));
+            result.push_back(std::move(boundary));
+        }
+        return result;
+    }
+
+    inline bool
+    sql_database::load( const std::string& _query, spreadsheet& _sheet ) noexcept {
+        try {
+            const Timer t;
+            sql_statement query { db_, _query };
+
+            // Column types from the declared table types where available,
+            // otherwise from the first non NULL value.
+            const int n_cols { query.columns() };
+            std::vector<std::string> names(n_cols);
+            std::vector<DataType> types(n_cols, DataType::NONE);
+            std::vector<column_id> ids(n_cols);
+            int time_col { -1 }, run_col { -1 }, row_col { -1 };
+            for ( int c { 0 }; c < n_cols; ++c ) {
+                names[c] = std::string { query.name(c) };
+                ids[c] = column_ids::intern(names[c]);
+                const auto declared { query.declared_type(c) };
+                if ( declared == "INTEGER" ) { types[c] = DataType::INTEGER; }
+                else if ( declared == "REAL" ) { types[c] = DataType::DOUBLE; }
+                else if ( declared == "TEXT" ) { types[c] = DataType::STRING; }
+
+                if ( names[c] == "internal_time_ns" ) { time_col = c; }
+                else if ( names[c] == "run_id" ) { run_col = c; }
+                else if ( names[c] == "row_idx" ) { row_col = c; }
+            }
+
+            column_table columns;
+            std::vector<nano> internal_time;
+            std::vector<file_boundary_t> boundaries;
+            std::map<integer, std::vector<file_boundary_t>> run_files;
+            const file_boundary_t* current_file { nullptr };
+            integer current_run { 0 };
+
+            // Columns typed by value are back filled once their type is known
+            const auto append =
+                [&]( const int _c, const uinteger& _row ) {
+                const auto& id { ids[_c] };
+                if ( types[_c] == DataType::NONE ) {
+                    switch ( query.type(_c) ) {
+                    case SQLITE_INTEGER: types[_c] = DataType::INTEGER; break;
+                    case SQLITE_FLOAT: types[_c] = DataType::DOUBLE; break;
+                    case SQLITE_TEXT: types[_c] = DataType::STRING; break;
+                    default: return;
+                    }
+                    switch ( types[_c] ) {
+                    case DataType::INTEGER: columns.add<integer>(id).resize(_row, 0); break;
+                    case DataType::DOUBLE: columns.add<double>(id).resize(_row, std::numeric_limits<double>::quiet_NaN()); break;
+                    case DataType::STRING: columns.add<std::string>(id).resize(_row); break;
+                    case DataType::NONE: break;
+                    }
+                }
+                switch ( types[_c] ) {
+                case DataType::INTEGER: columns.add<integer>(id).push_back(query.get_i(_c)); break;
+                case DataType::DOUBLE: columns.add<double>(id).push_back(query.get_d(_c)); break;
+                case DataType::STRING: columns.add<std::string>(id).push_back(query.get_s(_c)); break;
+                case DataType::NONE: break;
+                }
+            };
+
+            uinteger n_rows { 0 };
+            while ( query.step() ) {
+                for ( int c { 0 }; c < n_cols; ++c ) {
+                    if ( c != time_col ) { append(c, n_rows); }
+                }
+                internal_time.emplace_back(time_col >= 0 ? nano { query.get_i(time_col) } : nano { static_cast<integer>(n_rows) * 1'000'000'000 });
+
+                // Restore the boundary of the file each row came from
+                if ( run_col >= 0 && row_col >= 0 ) {
+                    const integer run_id { query.get_i(run_col) };
+                    const auto row { static_cast<uinteger>(query.get_i(row_col)) };
+                    if ( !current_file || run_id != current_run
+                         || row < current_file->row_offset || row >= current_file->row_offset + current_file->n_rows ) {
+                        if ( !run_files.contains(run_id) ) { run_files[run_id] = run_boundaries(run_id); }
+                        const auto& files { run_files.at(run_id) };
+                        const auto iter {
+                            std::ranges::upper_bound(files, row, {},
+                                                     &file_boundary_t::row_offset)
+                        };
+                        current_file = nullptr;
+                        current_run = run_id;
+                        if ( iter != files.begin() ) {
+                            current_file = &*std::prev(iter);
+                            file_boundary_t boundary { *current_file };
+                            boundary.internal_time = internal_time.back();
+                            boundary.row_offset = n_rows;
+                            boundary.n_rows = 0;
+                            boundaries.push_back(std::move(boundary));
+                        }
+                    }
+                    if ( current_file ) { ++boundaries.back().n_rows; }
+                }
+                ++n_rows;
+
+                // Columns which were NULL on this row
+                for ( int c { 0 }; c < n_cols; ++c ) {
+                    if ( c == time_col ) { continue; }
+                    switch ( types[c] ) {
+                    case DataType::INTEGER: columns.add<integer>(ids[c]).resize(n_rows, 0); break;
+                    case DataType::DOUBLE: columns.add<double>(ids[c]).resize(n_rows, std::numeric_limits<double>::quiet_NaN()); break;
+                    case DataType::STRING: columns.add<std::string>(ids[c]).resize(n_rows); break;
+                    case DataType::NONE: break;
+                    }
+                }
+            }
+
+            TypeMap cols;
+            for ( int c { 0 }; c < n_cols; ++c ) {
+                if ( c == time_col ) { continue; }
+                if ( types[c] == DataType::NONE ) {
+                    // Every value NULL
+                    types[c] = DataType::DOUBLE;
+                    columns.add<double>(ids[c]).assign(n_rows, std::numeric_limits<double>::quiet_NaN());
+                }
+                cols[names[c]] = types[c];
+            }
+
+            file_data data;
+            if ( !data.assign(cols, std::move(columns), std::move(internal_time), std::move(boundaries)) ) {
+                return false;
+            }
+            write_log(std::format("Loaded {} rows from query, {}s.", n_rows, t.elapsed()));
+            return _sheet.assign(std::move(data));
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <sql_database::load>");
+            return false;
+        }
+    }
+} // NAMESPACE: burn_in_data_report
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "../BIDR_Defines.h"
+#include "../S__Datastructures/BIDR_StringColumn.h"
+
+namespace burn_in_data_report
+{
+    // 64-bit FNV-1a, used for cache keys & file names
+    constexpr uint64_t
+    fnv1a( const std::string_view _bytes,
+           uint64_t _hash = 14695981039346656037ull ) noexcept {
+        for ( const char c : _bytes ) {
+            _hash ^= static_cast<uint64_t>(static_cast<unsigned char>(c));
+            _hash *= 1099511628211ull;
+        }
+        return _hash;
+    }
+
+    template <typename T>
+    concept BinaryType = std::is_trivially_copyable_v<T>;
+
+    /*
+    * Sequential writer for the binary storage formats. Values are written
+    * in native (little endian) layout. Output goes to a temporary file which
+    * replaces the target on commit(), so readers never see a partial file.
+    */
+    class binary_writer
+    {
+    private:
+        std::filesystem::path path_;
+        std::filesystem::path tmp_path_;
+        std::ofstream         stream_;
+        bool                  committed_;
+
+    public:
+        explicit binary_writer( const std::filesystem::path& _path ) :
+            path_ { _path },
+            tmp_path_ { _path },
+            committed_ { false } {
+            // Unique per thread, concurrent writers of the same target don't collide
+            tmp_path_ += std::format(".{}.tmp", std::hash<std::thread::id> {}(std::this_thread::get_id()));
+            stream_.open(tmp_path_, std::ios::out | std::ios::binary | std::ios::trunc);
+        }
+
+        ~binary_writer() {
+            if ( !committed_ ) {
+                if ( stream_.is_open() ) { stream_.close(); }
+                std::error_code ec;
+                std::filesystem::remove(tmp_path_, ec);
+            }
+        }
+
+        binary_writer( const binary_writer& _other ) = delete;
+        binary_writer& operator=( const binary_writer& _other ) = delete;
+
+        [[nodiscard]] bool is_open() const noexcept { return stream_.is_open(); }
+
+        [[nodiscard]] bool good() const noexcept { return stream_.good(); }
+
+        [[nodiscard]] uinteger tell() noexcept { return static_cast<uinteger>(stream_.tellp()); }
+
+        void write_bytes( const void* _src, const uinteger& _n ) {
+            stream_.write(static_cast<const char*>(_src), static_cast<std::streamsize>(_n));
+        }
+
+        template <BinaryType T>
+        void write( const T& _val ) { write_bytes(&_val, sizeof(T)); }
+
+        // Length prefixed string
+        void write( const std::string_view _str ) {
+            write(static_cast<uinteger>(_str.size()));
+            write_bytes(_str.data(), static_cast<uinteger>(_str.size()));
+        }
+
+        // Length prefixed array of values
+        template <BinaryType T>
+        void write( const std::vector<T>& _vec ) {
+            write(static_cast<uinteger>(_vec.size()));
+            write_bytes(_vec.data(), static_cast<uinteger>(_vec.size() * sizeof(T)));
+        }
+
+        void write( const std::vector<std::string>& _vec ) {
+            write(static_cast<uinteger>(_vec.size()));
+            for ( const auto& str : _vec ) { write(std::string_view { str }); }
+        }
+
+        // Dictionary offsets & bytes, then the row codes
+        void write( const string_column& _col ) {
+            write(_col.offsets());
+            write(std::string_view { _col.bytes() });
+            write(_col.codes());
+        }
+
+        // Zero pad up to the next multiple of _alignment
+        void align( const uinteger& _alignment ) {
+            static constexpr char zeros[64] {};
+            const uinteger pos { tell() };
+            if ( const uinteger rem { pos % _alignment }; rem != 0 ) {
+                uinteger pad { _alignment - rem };
+                while ( pad > 0 ) {
+                    const uinteger n { MIN(pad, static_cast<uinteger>(sizeof(zeros))) };
+                    write_bytes(zeros, n);
+                    pad -= n;
+                }
+            }
+        }
+
+        // Patch a value written earlier, e.g an offset table
+        template <BinaryType T>
+        void write_at( const uinteger& _pos, const T& _val ) {
+            const auto current { stream_.tellp() };
+            stream_.seekp(static_cast<std::streamoff>(_pos));
+            write(_val);
+            stream_.seekp(current);
+        }
+
+        // Flush & atomically replace the target file
+        bool commit() noexcept {
+            try {
+                stream_.flush();
+                if ( !stream_.good() ) { return false; }
+                stream_.close();
+
+                std::error_code ec;
+                std::filesystem::rename(tmp_path_, path_, ec);
+                if ( ec ) {
+                    write_err_log(std::runtime_error(ec.message()),
+                                  std::format("DLL: <binary_writer::commit> {}", path_.string()));
+                    return false;
+                }
+                committed_ = true;
+                return true;
+            }
+            catch ( const std::exception& err ) {
+                write_err_log(err, "DLL: <binary_writer::commit>");
+                return false;
+            }
+        }
+    };
+
+    /*
+    * Bounds checked reader over a block of bytes, typically a mapped_file
+    * view. Throws std::out_of_range on truncated / corrupt input.
+    */
+    class binary_reader
+    {
+    private:
+        std::string_view data_;
+        uinteger         pos_;
+
+        void require( const uinteger& _n ) const {
+            if ( _n > data_.size() - pos_ ) {
+                throw std::out_of_range(
+                    std::format("<binary_reader> Read of {} bytes at {} exceeds size {}.", _n, pos_, data_.size())
+                );
+            }
+        }
+
+    public:
+        explicit binary_reader( const std::string_view _data ) noexcept :
+            data_ { _data },
+            pos_ { 0 } {}
+
+        [[nodiscard]] uinteger tell() const noexcept { return pos_; }
+
+        [[nodiscard]] uinteger size() const noexcept { return static_cast<uinteger>(data_.size()); }
+
+        [[nodiscard]] uinteger remaining() const noexcept { return static_cast<uinteger>(data_.size()) - pos_; }
+
+        void seek( const uinteger& _pos ) {
+            if ( _pos > data_.size() ) { throw std::out_of_range("<binary_reader> Seek past end."); }
+            pos_ = _pos;
+        }
+
+        // View of _n bytes at _pos, without moving the read position
+        [[nodiscard]] std::string_view view( const uinteger& _pos, const uinteger& _n ) const {
+            if ( _pos > data_.size() || _n > data_.size() - _pos ) {
+                throw std::out_of_range("<binary_reader> View exceeds size.");
+            }
+            return data_.substr(_pos, _n);
+        }
+
+        void read_bytes( void* _dest, const uinteger& _n ) {
+            require(_n);
+            if ( _n > 0 ) { std::memcpy(_dest, data_.data() + pos_, _n); }
+            pos_ += _n;
+        }
+
+        template <BinaryType T>
+        T read() {
+            T val;
+            read_bytes(&val, sizeof(T));
+            return val;
+        }
+
+        // Length prefixed string, views the underlying data
+        std::string_view read_string() {
+            const auto n { read<uinteger>() };
+            require(n);
+            const auto result { data_.substr(pos_, n) };
+            pos_ += n;
+            return result;
+        }
+
+        template <BinaryType T>
+        void read( std::vector<T>& _vec ) {
+            const auto n { read<uinteger>() };
+            if ( n > remaining() / sizeof(T) ) { throw std::out_of_range("<binary_reader> Array exceeds size."); }
+            _vec.resize(n);
+            read_bytes(_vec.data(), n * sizeof(T));
+        }
+
+        void read( std::vector<std::string>& _vec ) {
+            const auto n { read<uinteger>() };
+            if ( n > remaining() / sizeof(uinteger) ) { throw std::out_of_range("<binary_reader> Array exceeds size."); }
+            _vec.clear();
+            _vec.reserve(n);
+            for ( uinteger i { 0 }; i < n; ++i ) { _vec.emplace_back(read_string()); }
+        }
+
+        void read( string_column& _col ) {
+            std::vector<uinteger> offsets;
+            read(offsets);
+            const auto bytes { read_string() };
+            std::vector<string_column::code_type> codes;
+            read(codes);
+            _col.assign(bytes, std::move(offsets), std::move(codes));
+        }
+
+        // Moves past an array written as std::vector<T> (or a string_column), without reading it
+        template <typename T>
+        void skip() {
+            if constexpr ( std::is_same_v<T, string_column> ) {
+                skip<uinteger>();
+                read_string();
+                skip<string_column::code_type>();
+            }
+            else if constexpr ( std::is_same_v<T, std::string> ) {
+                const auto n { read<uinteger>() };
+                for ( uinteger i { 0 }; i < n; ++i ) { read_string(); }
+            }
+            else {
+                const auto n { read<uinteger>() };
+                if ( n > remaining() / sizeof(T) ) { throw std::out_of_range("<binary_reader> Array exceeds size."); }
+                pos_ += n * sizeof(T);
+            }
+        }
+    };
+} // NAMESPACE: burn_in_data_report
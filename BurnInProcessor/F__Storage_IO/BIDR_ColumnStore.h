@@ -0,0 +1,467 @@
+#pragma once
+
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <map>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../BIDR_Defines.h"
+#include "../S__Datastructures/BIDR_StorageTypes.h"
+#include "../S__Datastructures/BIDR_StringColumn.h"
+#include "BIDR_BinaryIO.h"
+
+namespace burn_in_data_report
+{
+    /*
+    * Chunked columnar container for a combined dataset (.bidrcs).
+    *
+    * Layout:
+    * - Header: magic, version, directory offset.
+    * - Column chunks: each chunk is the raw values of up to chunk_rows rows
+    *   of one column, 64 byte aligned so chunks can be viewed directly from
+    *   a mapping. Strings are dictionary encoded: chunks hold uint32 codes,
+    *   the dictionary is stored once per column.
+    * - Directory: row count, internal time base chunks (int64 nanoseconds),
+    *   the file boundaries table & per column type, dictionary location and
+    *   per chunk offset / row count / min / max.
+    *
+    * Reading only parses the directory, column data is paged in from the
+    * mapping when a column is requested.
+    */
+    inline constexpr char     column_store_magic[8] { 'B', 'I', 'D', 'R', 'C', 'S', '0', '1' };
+    inline constexpr uint32_t column_store_version { 1 };
+    inline constexpr uinteger column_store_chunk_rows { 65536 };
+    inline constexpr uinteger column_store_alignment { 64 };
+
+#pragma pack(push, 8)
+    struct column_chunk_t
+    {
+        uinteger offset; // Byte offset of the chunk's values in the file
+        uinteger n_rows; // Rows held in the chunk
+        integer  min_i;  // Min / max of INTEGER values (or STRING codes)
+        integer  max_i;
+        double   min_d;  // Min / max of DOUBLE values, NaN entries ignored
+        double   max_d;
+    };
+#pragma pack(pop)
+
+    struct column_entry_t
+    {
+        std::string                 name;
+        DataType                    type;
+        uinteger                    dict_offset; // STRING only: dictionary location
+        uinteger                    dict_size;   // STRING only: number of dictionary entries
+        std::vector<column_chunk_t> chunks;
+    };
+
+
+    class column_store_writer
+    {
+    private:
+        binary_writer                   out_;
+        uinteger                        n_rows_;
+        uinteger                        chunk_rows_;
+        uinteger                        directory_pos_;
+        std::vector<column_chunk_t>     time_chunks_;
+        std::vector<file_boundary_t>    boundaries_;
+        std::vector<column_entry_t>     columns_;
+
+        template <BinaryType T>
+        std::vector<column_chunk_t>
+        write_chunks( const std::vector<T>& _values );
+
+        void
+        check_length( const std::string& _name, const uinteger& _n ) const {
+            if ( _n != n_rows_ ) {
+                throw std::runtime_error(
+                    std::format("<column_store_writer> Column {} has {} rows, expected {}.", _name, _n, n_rows_)
+                );
+            }
+        }
+
+    public:
+        column_store_writer( const std::filesystem::path& _path,
+                             const uinteger& _n_rows,
+                             const uinteger& _chunk_rows = column_store_chunk_rows );
+
+        [[nodiscard]] bool is_open() const noexcept { return out_.is_open(); }
+
+        void
+        add_column( const std::string& _name, const std::vector<integer>& _values );
+        void
+        add_column( const std::string& _name, const std::vector<double>& _values );
+        void
+        add_column( const std::string& _name, const string_column& _values );
+
+        void
+        set_internal_time( const std::vector<nano>& _time );
+
+        void set_file_boundaries( const std::vector<file_boundary_t>& _boundaries ) { boundaries_ = _boundaries; }
+
+        // Writes the directory & atomically replaces the target file
+        bool
+        commit() noexcept;
+    };
+
+
+    inline
+    column_store_writer::column_store_writer( const std::filesystem::path& _path,
+                                              const uinteger& _n_rows,
+                                              const uinteger& _chunk_rows ) :
+        out_ { _path },
+        n_rows_ { _n_rows },
+        chunk_rows_ { _chunk_rows > 0 ? _chunk_rows : column_store_chunk_rows },
+        directory_pos_ { 0 } {
+        if ( !out_.is_open() ) { return; }
+
+        out_.write_bytes(column_store_magic, sizeof(column_store_magic));
+        out_.write(column_store_version);
+        out_.write(static_cast<uint32_t>(0));
+        directory_pos_ = out_.tell();
+        out_.write(static_cast<uinteger>(0)); // Patched with the directory offset on commit
+    }
+
+    template <BinaryType T>
+    std::vector<column_chunk_t>
+    column_store_writer::write_chunks( const std::vector<T>& _values ) {
+        std::vector<column_chunk_t> chunks;
+        chunks.reserve((_values.size() + chunk_rows_ - 1) / chunk_rows_);
+
+        for ( uinteger start { 0 }; start < _values.size(); start += chunk_rows_ ) {
+            const uinteger n { MIN(chunk_rows_, static_cast<uinteger>(_values.size()) - start) };
+
+            column_chunk_t chunk {
+                0, n,
+                std::numeric_limits<integer>::max(), std::numeric_limits<integer>::lowest(),
+                std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN()
+            };
+            for ( uinteger i { start }; i < start + n; ++i ) {
+                if constexpr ( std::is_floating_point_v<T> ) {
+                    const double val { static_cast<double>(_values[i]) };
+                    if ( std::isnan(val) ) { continue; }
+                    if ( std::isnan(chunk.min_d) || val < chunk.min_d ) { chunk.min_d = val; }
+                    if ( std::isnan(chunk.max_d) || val > chunk.max_d ) { chunk.max_d = val; }
+                }
+                else {
+                    const auto val { static_cast<integer>(_values[i]) };
+                    chunk.min_i = MIN(chunk.min_i, val);
+                    chunk.max_i = MAX(chunk.max_i, val);
+                }
+            }
+
+            out_.align(column_store_alignment);
+            chunk.offset = out_.tell();
+            out_.write_bytes(_values.data() + start, n * sizeof(T));
+            chunks.push_back(chunk);
+        }
+
+        return chunks;
+    }
+
+    inline void
+    column_store_writer::add_column( const std::string& _name, const std::vector<integer>& _values ) {
+        check_length(_name, static_cast<uinteger>(_values.size()));
+        columns_.push_back(column_entry_t { _name, DataType::INTEGER, 0, 0, write_chunks(_values) });
+    }
+
+    inline void
+    column_store_writer::add_column( const std::string& _name, const std::vector<double>& _values ) {
+        check_length(_name, static_cast<uinteger>(_values.size()));
+        columns_.push_back(column_entry_t { _name, DataType::DOUBLE, 0, 0, write_chunks(_values) });
+    }
+
+    // The column is already dictionary encoded, its codes & dictionary are written as held
+    inline void
+    column_store_writer::add_column( const std::string& _name, const string_column& _values ) {
+        check_length(_name, _values.size());
+
+        auto chunks { write_chunks(_values.codes()) };
+
+        // Dictionary: entry offsets (n + 1) followed by the concatenated bytes
+        out_.align(column_store_alignment);
+        const uinteger dict_offset { out_.tell() };
+        for ( const auto& offset : _values.offsets() ) { out_.write(offset); }
+        out_.write_bytes(_values.bytes().data(), static_cast<uinteger>(_values.bytes().size()));
+
+        columns_.push_back(column_entry_t {
+            _name, DataType::STRING, dict_offset, _values.n_values(), std::move(chunks)
+        });
+    }
+
+    inline void
+    column_store_writer::set_internal_time( const std::vector<nano>& _time ) {
+        check_length("internal time", static_cast<uinteger>(_time.size()));
+
+        std::vector<integer> ticks;
+        ticks.reserve(_time.size());
+        for ( const auto& t : _time ) { ticks.push_back(static_cast<integer>(t.count())); }
+        time_chunks_ = write_chunks(ticks);
+    }
+
+    inline bool
+    column_store_writer::commit() noexcept {
+        try {
+            const auto write_chunk_table =
+                [this]( const std::vector<column_chunk_t>& _chunks ) {
+                    out_.write(static_cast<uinteger>(_chunks.size()));
+                    for ( const auto& chunk : _chunks ) { out_.write(chunk); }
+                };
+
+            out_.align(column_store_alignment);
+            const uinteger directory_offset { out_.tell() };
+
+            out_.write(n_rows_);
+            out_.write(chunk_rows_);
+            write_chunk_table(time_chunks_);
+
+            out_.write(static_cast<uinteger>(boundaries_.size()));
+            for ( const auto& boundary : boundaries_ ) {
+                out_.write(boundary.index);
+                out_.write(std::string_view { boundary.file_name });
+                out_.write(static_cast<integer>(boundary.internal_time.count()));
+                out_.write(static_cast<integer>(boundary.start_time.time_since_epoch().count()));
+                out_.write(boundary.row_offset);
+                out_.write(boundary.n_rows);
+            }
+
+            out_.write(static_cast<uinteger>(columns_.size()));
+            for ( const auto& column : columns_ ) {
+                out_.write(std::string_view { column.name });
+                out_.write(static_cast<uint32_t>(column.type));
+                out_.write(column.dict_offset);
+                out_.write(column.dict_size);
+                write_chunk_table(column.chunks);
+            }
+
+            out_.write_at(directory_pos_, directory_offset);
+            return out_.commit();
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <column_store_writer::commit>");
+            return false;
+        }
+    }
+
+
+    class column_store
+    {
+    private:
+        std::shared_ptr<mapped_file>          map_;
+        std::filesystem::path                 path_;
+        uinteger                              n_rows_;
+        uinteger                              chunk_rows_;
+        std::vector<column_chunk_t>           time_chunks_;
+        std::vector<file_boundary_t>          boundaries_;
+        std::map<std::string, column_entry_t> columns_;
+
+        template <BinaryType T>
+        void
+        read_chunks( const std::vector<column_chunk_t>& _chunks, std::vector<T>& _dest ) const;
+
+        [[nodiscard]] const column_entry_t&
+        entry( const std::string& _name, const DataType& _type ) const;
+
+    public:
+        column_store() noexcept :
+            map_ {},
+            n_rows_ { 0 },
+            chunk_rows_ { 0 } {}
+
+        // Maps _path & parses the directory, no column data is read
+        bool
+        open( const std::filesystem::path& _path ) noexcept;
+
+        [[nodiscard]] bool is_open() const noexcept { return map_ != nullptr; }
+
+        // File mapped by open(), it can't be replaced while mapped
+        [[nodiscard]] const std::filesystem::path& path() const noexcept { return path_; }
+
+        [[nodiscard]] uinteger n_rows() const noexcept { return n_rows_; }
+
+        [[nodiscard]] const std::vector<file_boundary_t>& file_boundaries() const noexcept { return boundaries_; }
+
+        [[nodiscard]] bool contains( const std::string& _name ) const noexcept { return columns_.contains(_name); }
+
+        [[nodiscard]] TypeMap
+        col_types() const;
+
+        [[nodiscard]] const std::vector<column_chunk_t>&
+        chunks( const std::string& _name ) const { return columns_.at(_name).chunks; }
+
+        [[nodiscard]] std::vector<nano>
+        internal_time() const;
+
+        void
+        read( const std::string& _name, std::vector<integer>& _dest ) const { read_chunks(entry(_name, DataType::INTEGER).chunks, _dest); }
+
+        void
+        read( const std::string& _name, std::vector<double>& _dest ) const { read_chunks(entry(_name, DataType::DOUBLE).chunks, _dest); }
+
+        void
+        read( const std::string& _name, string_column& _dest ) const;
+
+        // Values of one chunk viewed in place (INTEGER / DOUBLE, or uint32 codes of STRING columns)
+        template <BinaryType T>
+        [[nodiscard]] std::span<const T>
+        chunk_view( const std::string& _name, const uinteger& _chunk ) const;
+    };
+
+
+    inline bool
+    column_store::open( const std::filesystem::path& _path ) noexcept {
+        try {
+            auto map { std::make_shared<mapped_file>() };
+            if ( !map->open(_path) ) {
+                throw std::runtime_error(std::format("Failed to map {}.", _path.string()));
+            }
+
+            binary_reader in { map->view() };
+
+            char magic[sizeof(column_store_magic)];
+            in.read_bytes(magic, sizeof(magic));
+            if ( std::memcmp(magic, column_store_magic, sizeof(magic)) != 0
+                 || in.read<uint32_t>() != column_store_version ) {
+                throw std::runtime_error(std::format("{} is not a column store, or an old version.", _path.string()));
+            }
+            static_cast<void>(in.read<uint32_t>());
+            in.seek(in.read<uinteger>());
+
+            const auto read_chunk_table =
+                [&in]( std::vector<column_chunk_t>& _chunks ) {
+                    const auto n { in.read<uinteger>() };
+                    if ( n > in.remaining() / sizeof(column_chunk_t) ) {
+                        throw std::out_of_range("<column_store::open> Chunk table exceeds file size.");
+                    }
+                    _chunks.resize(n);
+                    for ( auto& chunk : _chunks ) {
+                        chunk = in.read<column_chunk_t>();
+                        if ( chunk.offset > in.size() ) {
+                            throw std::out_of_range("<column_store::open> Chunk offset exceeds file size.");
+                        }
+                    }
+                };
+
+            n_rows_ = in.read<uinteger>();
+            chunk_rows_ = in.read<uinteger>();
+            read_chunk_table(time_chunks_);
+
+            boundaries_.clear();
+            const auto n_boundaries { in.read<uinteger>() };
+            for ( uinteger i { 0 }; i < n_boundaries; ++i ) {
+                file_boundary_t boundary;
+                boundary.index = in.read<integer>();
+                boundary.file_name = std::string { in.read_string() };
+                boundary.internal_time = nano { in.read<integer>() };
+                boundary.start_time = file_boundary_t::timepoint { nano { in.read<integer>() } };
+                boundary.row_offset = in.read<uinteger>();
+                boundary.n_rows = in.read<uinteger>();
+                boundaries_.push_back(std::move(boundary));
+            }
+
+            columns_.clear();
+            const auto n_cols { in.read<uinteger>() };
+            for ( uinteger i { 0 }; i < n_cols; ++i ) {
+                column_entry_t column;
+                column.name = std::string { in.read_string() };
+                column.type = static_cast<DataType>(in.read<uint32_t>());
+                column.dict_offset = in.read<uinteger>();
+                column.dict_size = in.read<uinteger>();
+                read_chunk_table(column.chunks);
+                columns_[column.name] = std::move(column);
+            }
+
+            map_ = std::move(map);
+            path_ = _path;
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <column_store::open>");
+            map_.reset();
+            n_rows_ = 0;
+            time_chunks_.clear();
+            boundaries_.clear();
+            columns_.clear();
+            return false;
+        }
+    }
+
+    inline const column_entry_t&
+    column_store::entry( const std::string& _name, const DataType& _type ) const {
+        const auto& column { columns_.at(_name) };
+        if ( column.type != _type ) {
+            throw std::runtime_error(
+                std::format("<column_store> Column {} is {}, not {}.", _name,
+                            type_string.at(column.type), type_string.at(_type))
+            );
+        }
+        return column;
+    }
+
+    inline TypeMap
+    column_store::col_types() const {
+        TypeMap result;
+        for ( const auto& [name, column] : columns_ ) { result[name] = column.type; }
+        return result;
+    }
+
+    template <BinaryType T>
+    void
+    column_store::read_chunks( const std::vector<column_chunk_t>& _chunks, std::vector<T>& _dest ) const {
+        binary_reader in { map_->view() };
+
+        uinteger n { 0 };
+        for ( const auto& chunk : _chunks ) { n += chunk.n_rows; }
+        _dest.resize(n);
+
+        uinteger pos { 0 };
+        for ( const auto& chunk : _chunks ) {
+            const auto bytes { in.view(chunk.offset, chunk.n_rows * sizeof(T)) };
+            std::memcpy(_dest.data() + pos, bytes.data(), bytes.size());
+            pos += chunk.n_rows;
+        }
+    }
+
+    inline std::vector<nano>
+    column_store::internal_time() const {
+        std::vector<integer> ticks;
+        read_chunks(time_chunks_, ticks);
+
+        std::vector<nano> result;
+        result.reserve(ticks.size());
+        for ( const auto& t : ticks ) { result.emplace_back(t); }
+        return result;
+    }
+
+    // The stored dictionary & codes become the column's own, no value is decoded
+    inline void
+    column_store::read( const std::string& _name, string_column& _dest ) const {
+        const auto& column { entry(_name, DataType::STRING) };
+
+        // Dictionary
+        binary_reader in { map_->view() };
+        in.seek(column.dict_offset);
+        std::vector<uinteger> offsets(column.dict_size + 1);
+        for ( auto& offset : offsets ) { offset = in.read<uinteger>(); }
+        const auto bytes { in.view(in.tell(), offsets.back()) };
+
+        std::vector<string_column::code_type> codes;
+        read_chunks(column.chunks, codes);
+
+        _dest.assign(bytes, std::move(offsets), std::move(codes));
+    }
+
+    template <BinaryType T>
+    std::span<const T>
+    column_store::chunk_view( const std::string& _name, const uinteger& _chunk ) const {
+        const auto& chunk { columns_.at(_name).chunks.at(_chunk) };
+        const binary_reader in { map_->view() };
+        const auto bytes { in.view(chunk.offset, chunk.n_rows * sizeof(T)) };
+        return std::span<const T> { reinterpret_cast<const T*>(bytes.data()), static_cast<std::size_t>(chunk.n_rows) };
+    }
+} // NAMESPACE: burn_in_data_report
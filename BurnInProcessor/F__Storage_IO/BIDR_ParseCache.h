@@ -0,0 +1,83 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+#include "../BIDR_Defines.h"
+#include "BIDR_BinaryIO.h"
+
+namespace burn_in_data_report
+{
+    /*
+    * Parse cache entries hold the parsed result of a single source file
+    * (file_settings, typed columns & file_stats), see file_data::store_cached.
+    * An entry is only used while the source file's size & last write time,
+    * the hash of the config it matched and the loading options which affect
+    * the parsed result are all unchanged.
+    */
+    inline constexpr char     parse_cache_magic[8] { 'B', 'I', 'D', 'R', 'P', 'C', '0', '1' };
+    inline constexpr uint32_t parse_cache_version { 3 };
+
+    struct parse_cache_key
+    {
+        std::string path;         // Absolute path of the source file
+        uinteger    file_size;    // Source size in bytes
+        integer     write_time;   // Source last write time, file clock ticks
+        uint64_t    options_hash; // Header limit, trimming & max off time
+
+        [[nodiscard]] bool
+        operator==( const parse_cache_key& _other ) const noexcept = default;
+
+        void
+        write( binary_writer& _out ) const {
+            _out.write_bytes(parse_cache_magic, sizeof(parse_cache_magic));
+            _out.write(parse_cache_version);
+            _out.write(std::string_view { path });
+            _out.write(file_size);
+            _out.write(write_time);
+            _out.write(options_hash);
+        }
+
+        // Throws if _in doesn't start with a parse cache header
+        static parse_cache_key
+        read( binary_reader& _in ) {
+            char magic[sizeof(parse_cache_magic)];
+            _in.read_bytes(magic, sizeof(magic));
+            if ( std::memcmp(magic, parse_cache_magic, sizeof(magic)) != 0
+                 || _in.read<uint32_t>() != parse_cache_version ) {
+                throw std::runtime_error("<parse_cache_key::read> Not a parse cache file, or an old version.");
+            }
+
+            parse_cache_key key;
+            key.path = std::string { _in.read_string() };
+            key.file_size = _in.read<uinteger>();
+            key.write_time = _in.read<integer>();
+            key.options_hash = _in.read<uint64_t>();
+            return key;
+        }
+
+        // Key describing the current state of _file on disk
+        static parse_cache_key
+        of( const std::filesystem::path& _file, const uint64_t& _options_hash ) {
+            const auto abs_path { std::filesystem::absolute(_file) };
+            return parse_cache_key {
+                abs_path.string(),
+                static_cast<uinteger>(std::filesystem::file_size(abs_path)),
+                static_cast<integer>(std::filesystem::last_write_time(abs_path).time_since_epoch().count()),
+                _options_hash
+            };
+        }
+    };
+
+    // Hash of a config, cache entries are invalidated when the matched config changes
+    inline uint64_t
+    config_hash( const nlohmann::json& _config ) { return fnv1a(_config.dump()); }
+
+    // Location of the cache entry for _key inside _cache_dir
+    inline std::filesystem::path
+    parse_cache_file( const std::filesystem::path& _cache_dir,
+                      const parse_cache_key& _key ) {
+        return _cache_dir / std::format("{:016x}.bidrc", fnv1a(_key.path));
+    }
+} // NAMESPACE: burn_in_data_report
@@ -0,0 +1,384 @@
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <shared_mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "../BIDR_Defines.h"
+#include "BIDR_StringColumn.h"
+
+namespace burn_in_data_report
+{
+    // Dense id of an interned column title, see column_ids
+    using column_id = uint32_t;
+    constexpr column_id no_column { std::numeric_limits<column_id>::max() };
+
+    /*
+    * Process-wide interning of column titles. A title gets the next dense id
+    * the first time it's seen & keeps it for the life of the process, so the
+    * same id names the column in every table. Configs intern their columns
+    * when compiled, the loading stages then index columns by id & only calls
+    * taking a title hash it.
+    */
+    class column_ids
+    {
+    private:
+        struct title_hash
+        {
+            using is_transparent = void;
+
+            std::size_t
+            operator()( const std::string_view _s ) const noexcept { return std::hash<std::string_view> {}(_s); }
+        };
+
+        struct registry
+        {
+            std::shared_mutex                                                           mtx;
+            std::unordered_map<std::string, column_id, title_hash, std::equal_to<>> ids;
+            std::deque<std::string>                                                     titles; // By id, never moved
+        };
+
+        static registry&
+        get_registry() {
+            static registry reg;
+            return reg;
+        }
+
+    public:
+        // Id of _title, interning it if it's new
+        static column_id
+        intern( const std::string_view _title ) {
+            auto& reg { get_registry() };
+            {
+                std::shared_lock lock { reg.mtx };
+                if ( const auto iter { reg.ids.find(_title) }; iter != reg.ids.end() ) { return iter->second; }
+            }
+
+            std::unique_lock lock { reg.mtx };
+            const auto [iter, added] { reg.ids.try_emplace(std::string { _title }, static_cast<column_id>(reg.titles.size())) };
+            if ( added ) { reg.titles.emplace_back(_title); }
+            return iter->second;
+        }
+
+        // Id of _title, no_column if it was never interned
+        [[nodiscard]] static column_id
+        find( const std::string_view _title ) noexcept {
+            auto& reg { get_registry() };
+            std::shared_lock lock { reg.mtx };
+            const auto iter { reg.ids.find(_title) };
+            return iter != reg.ids.end() ? iter->second : no_column;
+        }
+
+        [[nodiscard]] static const std::string&
+        title( const column_id& _id ) {
+            auto& reg { get_registry() };
+            std::shared_lock lock { reg.mtx };
+            return reg.titles.at(_id);
+        }
+    };
+
+    /*
+    * Typed columns indexed by column_id: one contiguous vector of column
+    * descriptors (type & values), a slot per interned id. Looking a column
+    * up is an index, not a string hash, & a column's type travels with its
+    * values rather than in a separate map. Strings are held dictionary
+    * encoded (string_column). DataType::NONE marks an empty slot, NONE typed
+    * config columns are held as strings (as parse_data always has).
+    */
+    class column_table
+    {
+    public:
+        using buffer = std::variant<std::vector<integer>, std::vector<double>, string_column>;
+
+        // Storage of a column of T
+        template <typename T>
+        using storage = std::conditional_t<std::is_same_v<T, std::string>, string_column, std::vector<T>>;
+
+        struct column
+        {
+            DataType type { DataType::NONE };
+            buffer   values {};
+        };
+
+        template <typename T>
+        static constexpr DataType type_of {
+            std::is_same_v<T, integer> ? DataType::INTEGER
+            : std::is_same_v<T, double> ? DataType::DOUBLE
+            : DataType::STRING
+        };
+
+    private:
+        std::vector<column> columns_ {}; // Indexed by column_id
+        uinteger            n_cols_ { 0 };
+
+        [[nodiscard]] const column&
+        slot( const column_id& _id ) const {
+            if ( !contains(_id) ) { throw std::out_of_range(std::format("No column with id {}.", _id)); }
+            return columns_[_id];
+        }
+
+    public:
+        [[nodiscard]] bool
+        contains( const column_id& _id ) const noexcept {
+            return _id < columns_.size() && columns_[_id].type != DataType::NONE;
+        }
+
+        [[nodiscard]] bool contains( const std::string_view _title ) const noexcept { return contains(column_ids::find(_title)); }
+
+        [[nodiscard]] DataType
+        type( const column_id& _id ) const noexcept { return contains(_id) ? columns_[_id].type : DataType::NONE; }
+
+        [[nodiscard]] uinteger size() const noexcept { return n_cols_; }
+
+        [[nodiscard]] bool empty() const noexcept { return n_cols_ == 0; }
+
+        // Ids of the columns held, ascending
+        [[nodiscard]] std::vector<column_id>
+        ids() const {
+            std::vector<column_id> result;
+            result.reserve(n_cols_);
+            for ( column_id id { 0 }; id < columns_.size(); ++id ) {
+                if ( columns_[id].type != DataType::NONE ) { result.push_back(id); }
+            }
+            return result;
+        }
+
+        // Bytes held by the columns' values
+        [[nodiscard]] uinteger
+        memory_usage() const noexcept {
+            uinteger bytes { 0 };
+            for ( const auto& col : columns_ ) {
+                bytes += std::visit([]<typename C>( const C& _values ) -> uinteger {
+                    if constexpr ( std::is_same_v<C, string_column> ) { return _values.memory_usage(); }
+                    else { return static_cast<uinteger>(_values.capacity() * sizeof(typename C::value_type)); }
+                }, col.values);
+            }
+            return bytes;
+        }
+
+        [[nodiscard]] uinteger
+        rows( const column_id& _id ) const {
+            return std::visit([]( const auto& _values ) { return static_cast<uinteger>(_values.size()); },
+                              slot(_id).values);
+        }
+
+        /*
+        * Column _id of _type, added empty if it isn't held (or held with
+        * another type). References into the table are invalidated by adding
+        * a column with a new highest id.
+        */
+        column&
+        add( const column_id& _id, DataType _type ) {
+            if ( _id == no_column ) { throw std::out_of_range("Invalid column id."); }
+            if ( _type == DataType::NONE ) { _type = DataType::STRING; }
+            if ( _id >= columns_.size() ) { columns_.resize(static_cast<std::size_t>(_id) + 1); }
+
+            auto& col { columns_[_id] };
+            if ( col.type == _type ) { return col; }
+            if ( col.type == DataType::NONE ) { ++n_cols_; }
+            col.type = _type;
+            switch ( _type ) {
+            case DataType::INTEGER: col.values.emplace<std::vector<integer>>(); break;
+            case DataType::DOUBLE: col.values.emplace<std::vector<double>>(); break;
+            default: col.values.emplace<string_column>(); break;
+            }
+            return col;
+        }
+
+        template <typename T>
+        storage<T>&
+        add( const column_id& _id ) { return std::get<storage<T>>(add(_id, type_of<T>).values); }
+
+        [[nodiscard]] const column& at( const column_id& _id ) const { return slot(_id); }
+
+        [[nodiscard]] column& at( const column_id& _id ) { return const_cast<column&>(slot(_id)); }
+
+        // Values of column _id, throws if it isn't held or holds another type
+        template <typename T>
+        [[nodiscard]] const storage<T>&
+        get( const column_id& _id ) const { return std::get<storage<T>>(slot(_id).values); }
+
+        template <typename T>
+        [[nodiscard]] storage<T>&
+        get( const column_id& _id ) { return std::get<storage<T>>(at(_id).values); }
+
+        // Values of column _id or nullptr, if it isn't held or holds another type
+        template <typename T>
+        [[nodiscard]] const storage<T>*
+        find( const column_id& _id ) const noexcept {
+            return contains(_id) ? std::get_if<storage<T>>(&columns_[_id].values) : nullptr;
+        }
+
+        bool
+        erase( const column_id& _id ) noexcept {
+            if ( !contains(_id) ) { return false; }
+            columns_[_id] = column {};
+            --n_cols_;
+            return true;
+        }
+
+        void
+        clear() noexcept {
+            columns_.clear();
+            n_cols_ = 0;
+        }
+
+        // Calls _f(id, column) for each column held, ascending id
+        template <typename F>
+        void
+        for_each( F&& _f ) {
+            for ( column_id id { 0 }; id < columns_.size(); ++id ) {
+                if ( columns_[id].type != DataType::NONE ) { _f(id, columns_[id]); }
+            }
+        }
+
+        template <typename F>
+        void
+        for_each( F&& _f ) const {
+            for ( column_id id { 0 }; id < columns_.size(); ++id ) {
+                if ( columns_[id].type != DataType::NONE ) { _f(id, columns_[id]); }
+            }
+        }
+    };
+
+    /*
+    * Calls _f with the row vector of _values: the values themselves, or a
+    * string column's codes. For operations that move rows about without
+    * reading them (trimming, filtering, splicing).
+    */
+    template <typename F>
+    decltype(auto)
+    visit_rows( F&& _f, column_table::buffer& _values ) {
+        return std::visit([&_f]<typename C>( C& _col ) -> decltype(auto) {
+            if constexpr ( std::is_same_v<C, string_column> ) { return _f(_col.codes()); }
+            else { return _f(_col); }
+        }, _values);
+    }
+
+    // Keeps only the rows of _rows within _ranges, in order
+    template <typename T>
+    void
+    keep_rows( std::vector<T>& _rows, const indices_t& _ranges ) {
+        std::vector<T> tmp;
+        tmp.reserve(_rows.size());
+        for ( const auto& [first, last] : _ranges ) {
+            tmp.insert(tmp.cend(), std::make_move_iterator(_rows.begin() + first),
+                       std::make_move_iterator(_rows.begin() + last));
+        }
+        _rows = std::move(tmp);
+    }
+
+    // Copy of the rows of _rows within _ranges, in order
+    template <typename T>
+    [[nodiscard]] std::vector<T>
+    select_rows( const std::vector<T>& _rows, const indices_t& _ranges ) {
+        uinteger n { 0 };
+        for ( const auto& [first, last] : _ranges ) { n += last - first; }
+        std::vector<T> result;
+        result.reserve(n);
+        for ( const auto& [first, last] : _ranges ) {
+            result.insert(result.cend(), _rows.begin() + first, _rows.begin() + last);
+        }
+        return result;
+    }
+
+    [[nodiscard]] inline string_column
+    select_rows( const string_column& _rows, const indices_t& _ranges ) { return _rows.select(_ranges); }
+
+    // Appends the rows of _src to _dest, a string column's codes are mapped to _dest's dictionary
+    template <typename T>
+    void
+    append_rows( std::vector<T>& _dest, const std::vector<T>& _src ) { _dest.insert(_dest.end(), _src.begin(), _src.end()); }
+
+    inline void append_rows( string_column& _dest, const string_column& _src ) { _dest.append(_src); }
+
+    /*
+    * Process-wide, strictly increasing stamp. A container takes a new one
+    * whenever views into it may have been invalidated, so a view is still
+    * valid while its generation matches the container's.
+    */
+    [[nodiscard]] inline uint64_t
+    next_generation() noexcept {
+        static std::atomic<uint64_t> generation { 0 };
+        return ++generation;
+    }
+
+    /*
+    * Read only view of a column of T, without copying it: the rows held
+    * (a string column's codes, with its dictionary) & a selection of them,
+    * ranges of rows() in order, or nullptr for every row. Valid until the
+    * generation of whatever it was taken from changes.
+    */
+    template <typename T>
+    class column_view
+    {
+    public:
+        using row_type = std::conditional_t<std::is_same_v<T, std::string>, string_column::code_type, T>;
+
+    private:
+        std::span<const row_type> rows_ {};
+        const string_column*      strings_ { nullptr };   // Dictionary, string columns only
+        const indices_t*          selection_ { nullptr };
+        uint64_t                  generation_ { 0 };
+
+    public:
+        column_view() = default;
+
+        column_view( const column_table::storage<T>& _values, const indices_t* _selection, const uint64_t _generation ) :
+            selection_(_selection),
+            generation_(_generation) {
+            if constexpr ( std::is_same_v<T, std::string> ) {
+                rows_ = _values.codes();
+                strings_ = &_values;
+            }
+            else { rows_ = _values; }
+        }
+
+        // Rows before the selection
+        [[nodiscard]] std::span<const row_type> rows() const noexcept { return rows_; }
+
+        [[nodiscard]] const indices_t* selection() const noexcept { return selection_; }
+
+        [[nodiscard]] uint64_t generation() const noexcept { return generation_; }
+
+        // Rows kept by the selection
+        [[nodiscard]] uinteger
+        size() const noexcept {
+            if ( !selection_ ) { return static_cast<uinteger>(rows_.size()); }
+            uinteger n { 0 };
+            for ( const auto& [first, last] : *selection_ ) { n += last - first; }
+            return n;
+        }
+
+        [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+        // Value of a row of rows(), strings as views into the dictionary
+        [[nodiscard]] auto
+        value( const row_type& _row ) const noexcept {
+            if constexpr ( std::is_same_v<T, std::string> ) { return strings_->value(_row); }
+            else { return _row; }
+        }
+
+        // Calls _f(value) for each selected row, in order
+        template <typename F>
+        void
+        for_each( F&& _f ) const {
+            if ( !selection_ ) {
+                for ( const auto& row : rows_ ) { _f(value(row)); }
+                return;
+            }
+            for ( const auto& [first, last] : *selection_ ) {
+                for ( const auto& row : rows_.subspan(first, last - first) ) { _f(value(row)); }
+            }
+        }
+    };
+} // NAMESPACE: burn_in_data_report
@@ -10,13 +10,20 @@
 #include <future>
 #include <limits>
 #include <map>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <thread>
 
+#include "BIDR_ColumnTable.h"
 #include "BIDR_StorageTypes.h"
+#include "BIDR_ThreadPool.h"
 #include "../BIDR_Defines.h"
+#include "../F__File_Parse/BIDR_ConfigCatalog.h"
+#include "../F__File_Parse/BIDR_ConfigDetect.h"
 #include "../F__File_Parse/BIDR_FileParse.h"
+#include "../F__Storage_IO/BIDR_ColumnStore.h"
+#include "../F__Storage_IO/BIDR_ParseCache.h"
 
 #include "BIDR_Timer.h"
 
@@ -90,6 +97,7 @@ namespace burn_in_data_report
         std::map<std::string, double> max_strings; // double value must equal NaN
         std::map<std::string, double> min_strings; // ""
         IMap _n;                                   // n for each grouping of values ^
+        std::map<std::string, uinteger> parse_failures; // Cells which failed to parse, per col. title
 
         file_stats() :
             max_ints({}),
@@ -107,23 +115,26 @@ namespace burn_in_data_report
         // File data, e.g path, file size, etc.
         std::vector<std::filesystem::directory_entry> files_;
         std::vector<std::string_view> lines_; // Stores lines of text file
-        // lines_ for each file loaded
-        std::vector<std::vector<std::string_view>> file_lines_;
+        // Line index of each file loaded, views texts_
+        std::vector<line_index> file_lines_;
         std::vector<encoding_type> encodings_; // Type of encoding in file
         std::vector<memory_handle> handles_;   // Handles for multiple files
+        // Read-only mappings of each file (ingest_mode::mapped only)
+        std::vector<std::shared_ptr<mapped_file>> maps_;
+        // Text of each file after BOM removal, views handles_ or maps_
+        std::vector<std::string_view> texts_;
         std::vector<file_settings> settings_;  // Vector of settings for the files
         std::vector<bool> success_;           // Indicates successful parses
+        std::vector<bool> parsed_;            // Indicates settings_, file_cols_ & statistics_
+                                              // hold the parsed file, it isn't re-read.
         std::vector<std::string> failed_loads_;
-        IMap ints_;                           // Map of col. title --> std::vec<ints>
-        DMap doubles_;                // Map of col. title --> std::vec<doubles>
-        SMap strings_;                // Map of col. title --> std::vec<strings>
-        std::vector<IMap> file_ints_; // Stores individiual file data before combining
-        std::vector<uinteger> ints_lens_;
-        std::vector<DMap> file_doubles_;
-        std::vector<uinteger> doubles_lens_;
-        std::vector<SMap> file_strings_;
-        std::vector<uinteger> strings_lens_;
+        column_table data_;                   // Combined columns, by column id
+        std::vector<column_table> file_cols_; // Stores individiual file data before combining
         std::vector<file_stats> statistics_;
+        // Row ranges of each file kept by trim_data (empty = all), applied to deferred columns
+        std::vector<indices_t> kept_rows_;
+        // file_cols_ entry was freed once combined (load_options::memory_budget), re-parsed if needed again
+        std::vector<bool> released_;
         // std::vector<std::pair<uint64_t, uint64_t>> filters_;
         uinteger header_max_sz_; // Max size of file headers, set in spreadsheet
         // "Settings" page
@@ -141,33 +152,58 @@ namespace burn_in_data_report
         std::vector<file_boundary_t> file_boundaries_;
         // Controls whether detected test failures are trimmed from the data.
         bool do_trimming_;
+        load_options options_;
+        // Executor for the per-file loading stages, sized from options_.n_threads.
+        std::shared_ptr<thread_pool> pool_;
+        // Column store the data was opened from, columns are paged in on request.
+        std::shared_ptr<column_store> store_;
+        // Data came from a column store or assign(), there are no files to add / remove.
+        bool read_only_;
+        // Changes whenever column views may have been invalidated, see next_generation.
+        uint64_t generation_;
+        // Highest memory_usage() seen, sampled after each loading stage
+        uinteger peak_memory_;
 
         char*
         get() const noexcept;
         char*
         get( const uinteger& start, const uinteger& end ) const;
         bool
-        async_get_files() noexcept;
+        process_file( const uinteger& _idx, const schema_map& _schemas, const config_detector& _detector,
+                      std::string& _err ) noexcept;
+        void
+        release_file( const uinteger& _idx ) noexcept;
+        [[nodiscard]] uint64_t
+        cache_options_hash() const noexcept;
         bool
-        async_encode_adjust_files() noexcept;
+        load_cached( const uinteger& _idx, const schema_map& _schemas ) noexcept;
         bool
-        async_process_files() noexcept;
-        bool
-        async_text_to_lines() noexcept;
+        store_cached( const uinteger& _idx ) const noexcept;
         bool
-        async_parse_file_type( const std::filesystem::path& _configPath );
+        open_cached( const uinteger& _idx, const schema_map& _schemas,
+                     mapped_file& _map, binary_reader& _in, file_settings& _settings ) const;
         bool
-        async_header_halt_scan() noexcept;
+        load_cached_column( const uinteger& _idx, const std::string& _key ) noexcept;
+        [[nodiscard]] bool
+        has_column( const uinteger& _idx, const std::string& _key ) const noexcept;
+        [[nodiscard]] bool
+        is_complete( const uinteger& _idx ) const noexcept;
+        void
+        load_deferred_file( const uinteger& _idx, const std::string& _key );
         bool
-        async_time_stamp_scan() noexcept;
+        load_deferred( const std::string& _key ) noexcept;
         bool
-        async_column_title_scan() noexcept;
+        parse_pending() noexcept;
         bool
-        async_parse_data() noexcept;
-        bool
-        async_trim_data() noexcept;
+        async_process_files() noexcept;
         bool
         async_combine_data() noexcept;
+        [[nodiscard]] bool
+        over_budget( const uinteger& _extra = 0 ) const noexcept;
+        void
+        release_columns( const uinteger& _idx ) noexcept;
+        void
+        note_memory() noexcept { peak_memory_ = std::max(peak_memory_, memory_usage()); }
         bool
         swap( const uinteger& _a, const uinteger& _b ) noexcept;
         bool
@@ -180,6 +216,10 @@ namespace burn_in_data_report
         sort_files() noexcept;
         bool
         recalculate_files() noexcept;
+        void
+        reset_data() noexcept;
+        void
+        finish_external( const TypeMap& _cols ) noexcept;
 
     public:
         file_data() :
@@ -192,28 +232,36 @@ namespace burn_in_data_report
             file_lines_(0),
             encodings_({}),
             handles_({}),
+            maps_({}),
+            texts_({}),
             settings_({}),
             success_({}),
+            parsed_({}),
             failed_loads_({}),
-            ints_(),
-            doubles_(),
-            strings_(),
-            ints_lens_(0),
-            doubles_lens_(0),
-            strings_lens_(0),
+            data_(),
+            file_cols_(0),
             statistics_(0),
+            kept_rows_(0),
+            released_({}),
             header_max_sz_ { 0 },
             max_off_time_ { 5min },
             internal_time_(),
             file_boundaries_(),
-            do_trimming_ { true } {}
+            do_trimming_ { true },
+            options_(),
+            pool_(),
+            store_(),
+            read_only_ { false },
+            generation_ { next_generation() },
+            peak_memory_ { 0 } {}
 
         file_data( const std::filesystem::directory_entry& file,
                    const std::filesystem::directory_entry& config_loc =
                        std::filesystem::directory_entry { "" },
                    const uinteger& header_max_lim = 256,
                    const nano& max_off_time = 5min,
-                   const bool& trimming = true ) :
+                   const bool& trimming = true,
+                   const load_options& options = load_options {} ) :
             memory_handle {},
             file_settings(file.path().string().substr(
                                                       file.path().string().rfind('.'),
@@ -226,24 +274,28 @@ namespace burn_in_data_report
             file_lines_ { {} },
             encodings_({ encoding_type::UNKNOWN }),
             handles_ { { memory_handle {} } },
+            maps_ { { nullptr } },
+            texts_ { { std::string_view {} } },
             settings_ { { file_settings { "", 256 } } },
             success_({ true }),
+            parsed_({ false }),
             failed_loads_({}),
-            ints_ { {} },
-            doubles_ { {} },
-            strings_ { {} },
-            file_ints_(1),
-            ints_lens_(1, 0),
-            file_doubles_(1),
-            doubles_lens_(1, 0),
-            file_strings_(1),
-            strings_lens_(1, 0),
+            data_(),
+            file_cols_(1),
             statistics_(1),
+            kept_rows_(1),
+            released_({ false }),
             header_max_sz_ { header_max_lim },
             max_off_time_ { max_off_time },
             internal_time_(),
             file_boundaries_(),
-            do_trimming_ { trimming } {
+            do_trimming_ { trimming },
+            options_ { options },
+            pool_(),
+            store_(),
+            read_only_ { false },
+            generation_ { next_generation() },
+            peak_memory_ { 0 } {
             const Timer t;
             if ( !recalculate_files() ) {
                 throw std::runtime_error("Failed to process files.");
@@ -256,7 +308,8 @@ namespace burn_in_data_report
                                 std::filesystem::directory_entry { "" },
                             const uinteger& header_max_lim = 256,
                             const nano& max_off_time = 5min,
-                            const bool& trimming = true ) :
+                            const bool& trimming = true,
+                            const load_options& options = load_options {} ) :
             memory_handle {},
             file_settings { std::string(""), header_max_lim },
             file_stats(),
@@ -265,24 +318,28 @@ namespace burn_in_data_report
             lines_(0),
             encodings_({}),
             handles_({}),
+            maps_({}),
+            texts_({}),
             settings_({}),
             success_({}),
+            parsed_({}),
             failed_loads_({}),
-            ints_(),
-            doubles_(),
-            strings_(),
-            file_ints_(0),
-            ints_lens_(0),
-            file_doubles_(0),
-            doubles_lens_(0),
-            file_strings_(0),
-            strings_lens_(0),
+            data_(),
+            file_cols_(0),
             statistics_(0),
+            kept_rows_(0),
+            released_({}),
             header_max_sz_ { header_max_lim },
             max_off_time_ { max_off_time },
             internal_time_(),
             file_boundaries_(),
-            do_trimming_ { trimming } {
+            do_trimming_ { trimming },
+            options_ { options },
+            pool_(),
+            store_(),
+            read_only_ { false },
+            generation_ { next_generation() },
+            peak_memory_ { 0 } {
             // Initialize vectors for async file processing
             const Timer t;
             if ( !recalculate_files() ) {
@@ -293,7 +350,8 @@ namespace burn_in_data_report
 
         ~file_data() = default;
 
-        file_data( const file_data& _other ) = default;
+        file_data( const file_data& _other ) :
+            file_data() { *this = _other; }
         file_data&
         operator=( const file_data& _other ) noexcept;
         file_data( file_data&& _other ) = default;
@@ -314,56 +372,51 @@ namespace burn_in_data_report
             return time_data;
         }
 
-        [[nodiscard]] IMap get_i() const noexcept {
-            try { return ints_; }
-            catch ( const std::exception& err ) { write_err_log(err, "DLL: <file_data::get_i>"); }
-        }
-
         [[nodiscard]] std::vector<integer> get_i( const std::string& _key ) const noexcept {
-            try { return ints_.at(_key); }
+            try { return data_.get<integer>(column_ids::find(_key)); }
             catch ( const std::exception& err ) {
                 write_err_log(err, std::format("DLL: <file_data::get_i> (key = {})", _key));
                 return std::vector<integer> {};
             }
         }
 
-        [[nodiscard]] DMap get_d() const noexcept {
-            try { return doubles_; }
-            catch ( const std::exception& err ) {
-                write_err_log(err, "DLL: <file_data::get_d>");
-                return DMap {};
-            }
-        }
-
         [[nodiscard]] std::vector<double> get_d( const std::string& _key ) const noexcept {
-            try { return doubles_.at(_key); }
+            try { return data_.get<double>(column_ids::find(_key)); }
             catch ( const std::exception& err ) {
                 write_err_log(err, std::format("DLL: <file_data::get_d> (key = {})", _key));
                 return std::vector<double> {};
             }
         }
 
-        [[nodiscard]] SMap get_s() const noexcept {
-            try { return strings_; }
+        [[nodiscard]] std::vector<std::string> get_s( const std::string& _key ) const noexcept {
+            try { return data_.get<std::string>(column_ids::find(_key)).to_strings(); }
             catch ( const std::exception& err ) {
-                write_err_log(err, "DLL: <file_data::get_d>");
-                return SMap {};
+                write_err_log(err, std::format("DLL: <file_data::get_i> (key = {})", _key));
+                return std::vector<std::string> {};
             }
         }
 
-        [[nodiscard]] std::vector<std::string> get_s( const std::string& _key ) const noexcept {
-            try { return strings_.at(_key); }
+        // Column _key without copying, empty if it isn't held as T (see get_i / get_d / get_s)
+        template <typename T>
+        [[nodiscard]] column_view<T>
+        view( const std::string& _key ) const noexcept {
+            try { return column_view<T> { data_.get<T>(column_ids::find(_key)), nullptr, generation_ }; }
             catch ( const std::exception& err ) {
-                write_err_log(err, std::format("DLL: <file_data::get_i> (key = {})", _key));
-                return std::vector<std::string> {};
+                write_err_log(err, std::format("DLL: <file_data::view> (key = {})", _key));
+                return column_view<T> {};
             }
         }
 
-        [[nodiscard]] std::vector<IMap> get_vi() const noexcept { return file_ints_; }
+        [[nodiscard]] uint64_t generation() const noexcept { return generation_; }
+
+        // Bytes currently held: raw text, line indexes, per-file & combined columns
+        [[nodiscard]] uinteger
+        memory_usage() const noexcept;
 
-        [[nodiscard]] std::vector<DMap> get_vd() const noexcept { return file_doubles_; }
+        // Highest memory_usage() seen since loading began
+        [[nodiscard]] uinteger peak_memory_usage() const noexcept { return std::max(peak_memory_, memory_usage()); }
 
-        [[nodiscard]] std::vector<SMap> get_vs() const noexcept { return file_strings_; }
+        [[nodiscard]] const std::vector<column_table>& get_file_columns() const noexcept { return file_cols_; }
 
         [[nodiscard]] std::vector<bool> get_load_info() const noexcept { return success_; }
         [[nodiscard]] auto get_failed_loads() const noexcept { return failed_loads_; }
@@ -383,6 +436,35 @@ namespace burn_in_data_report
         bool
         remove_files( const std::vector<uinteger>& indexes ) noexcept;
 
+        // Column store (.bidrcs) persistence, see BIDR_ColumnStore.h
+        bool
+        save_store( const std::filesystem::path& _path ) noexcept;
+        bool
+        open_store( const std::filesystem::path& _path ) noexcept;
+        bool
+        page_in( const std::string& _key ) noexcept;
+
+        [[nodiscard]] bool is_store() const noexcept { return store_ != nullptr; }
+
+        [[nodiscard]] bool is_read_only() const noexcept { return read_only_; }
+
+        // Column left out of loading (load_options::columns / lazy), page_in parses it
+        [[nodiscard]] bool
+        is_deferred( const std::string& _key ) const noexcept {
+            return !read_only_ && _key != "Combined Time" && !options_.parses(_key)
+                   && get_col_types().contains(_key);
+        }
+
+        // Replace the loaded data with columns read from elsewhere (e.g the SQL store)
+        bool
+        assign( const TypeMap& _cols, column_table&& _data, std::vector<nano>&& _internal_time,
+                std::vector<file_boundary_t>&& _boundaries ) noexcept;
+
+        // Combined columns without copying, columns of an opened store must be paged in first
+        [[nodiscard]] const column_table& columns() const noexcept { return data_; }
+
+        [[nodiscard]] const std::vector<file_settings>& get_file_settings() const noexcept { return settings_; }
+
         [[nodiscard]] const std::vector<std::filesystem::directory_entry>& files() const noexcept { return files_; }
 
         [[nodiscard]] std::vector<encoding_type> get_encoding() const noexcept { return encodings_; }
@@ -397,12 +479,10 @@ namespace burn_in_data_report
 
         [[noreturn]] void do_trimming( const bool& b ) { do_trimming_ = b; }
 
-        friend bool
-        verify_configs( const std::map<std::string, nlohmann::json>& _configs,
-                        const std::vector<std::string_view>& lines,
-                        const uinteger& _header_lim, nlohmann::json& _result );
+        [[nodiscard]] const load_options& options() const noexcept { return options_; }
+
         friend encoding_type
-        find_encoding_type( memory_handle& _handle );
+        find_encoding_type( const std::string_view _text );
 
         template <typename T>
         friend bool
@@ -427,24 +507,36 @@ namespace burn_in_data_report
         file_lines_ = _other.file_lines_;
         encodings_ = _other.encodings_;
         handles_ = _other.handles_;
+        maps_ = _other.maps_;
+        texts_ = _other.texts_;
         settings_ = _other.settings_;
         success_ = _other.success_;
+        parsed_ = _other.parsed_;
         failed_loads_ = _other.failed_loads_;
-        ints_ = _other.ints_;
-        doubles_ = _other.doubles_;
-        strings_ = _other.strings_;
-        file_ints_ = _other.file_ints_;
-        ints_lens_ = _other.ints_lens_;
-        file_doubles_ = _other.file_doubles_;
-        doubles_lens_ = _other.doubles_lens_;
-        file_strings_ = _other.file_strings_;
-        strings_lens_ = _other.strings_lens_;
+        data_ = _other.data_;
+        file_cols_ = _other.file_cols_;
         statistics_ = _other.statistics_;
+        kept_rows_ = _other.kept_rows_;
+        released_ = _other.released_;
         header_max_sz_ = _other.header_max_sz_;
         max_off_time_ = _other.max_off_time_;
         internal_time_ = _other.internal_time_;
         file_boundaries_ = _other.file_boundaries_;
         do_trimming_ = _other.do_trimming_;
+        options_ = _other.options_;
+        pool_ = _other.pool_;
+        store_ = _other.store_;
+        read_only_ = _other.read_only_;
+        generation_ = next_generation();
+        peak_memory_ = _other.peak_memory_;
+
+        // Texts kept for deferred columns must view the copied buffers, not _other's
+        for ( uinteger i { 0 }; i < texts_.size(); ++i ) {
+            if ( texts_[i].empty() || !handles_[i]._data ) { continue; }
+            const auto offset { texts_[i].data() - _other.handles_[i]._data };
+            texts_[i] = std::string_view { handles_[i]._data + offset, texts_[i].size() };
+            file_lines_[i].rebase(texts_[i]);
+        }
 
         return *this;
     }
@@ -452,34 +544,38 @@ namespace burn_in_data_report
     inline file_data&
     file_data::operator=( file_data&& _other ) noexcept { // Move assignment
 
-        memory_handle::operator=(_other);
-        file_settings::operator=(_other);
-        file_stats::operator=(_other);
-
-        config_loc_ = _other.config_loc_;
-        files_ = _other.files_;
-        lines_ = _other.lines_;
-        file_lines_ = _other.file_lines_;
-        encodings_ = _other.encodings_;
-        handles_ = _other.handles_;
-        settings_ = _other.settings_;
-        success_ = _other.success_;
-        failed_loads_ = _other.failed_loads_;
-        ints_ = _other.ints_;
-        doubles_ = _other.doubles_;
-        strings_ = _other.strings_;
-        file_ints_ = _other.file_ints_;
-        ints_lens_ = _other.ints_lens_;
-        file_doubles_ = _other.file_doubles_;
-        doubles_lens_ = _other.doubles_lens_;
-        file_strings_ = _other.file_strings_;
-        strings_lens_ = _other.strings_lens_;
-        statistics_ = _other.statistics_;
+        memory_handle::operator=(std::move(_other));
+        file_settings::operator=(std::move(_other));
+        file_stats::operator=(std::move(_other));
+
+        config_loc_ = std::move(_other.config_loc_);
+        files_ = std::move(_other.files_);
+        lines_ = std::move(_other.lines_);
+        file_lines_ = std::move(_other.file_lines_);
+        encodings_ = std::move(_other.encodings_);
+        handles_ = std::move(_other.handles_);
+        maps_ = std::move(_other.maps_);
+        texts_ = std::move(_other.texts_);
+        settings_ = std::move(_other.settings_);
+        success_ = std::move(_other.success_);
+        parsed_ = std::move(_other.parsed_);
+        failed_loads_ = std::move(_other.failed_loads_);
+        data_ = std::move(_other.data_);
+        file_cols_ = std::move(_other.file_cols_);
+        statistics_ = std::move(_other.statistics_);
+        kept_rows_ = std::move(_other.kept_rows_);
+        released_ = std::move(_other.released_);
         header_max_sz_ = _other.header_max_sz_;
         max_off_time_ = _other.max_off_time_;
-        internal_time_ = _other.internal_time_;
-        file_boundaries_ = _other.file_boundaries_;
+        internal_time_ = std::move(_other.internal_time_);
+        file_boundaries_ = std::move(_other.file_boundaries_);
         do_trimming_ = _other.do_trimming_;
+        options_ = std::move(_other.options_);
+        pool_ = std::move(_other.pool_);
+        store_ = std::move(_other.store_);
+        read_only_ = _other.read_only_;
+        generation_ = next_generation();
+        peak_memory_ = _other.peak_memory_;
 
         return *this;
     }
@@ -508,32 +604,22 @@ namespace burn_in_data_report
 
             adjust_size(encodings_, static_cast<uinteger>(files_.size()), encoding_type::UNKNOWN);
             adjust_size(handles_, static_cast<uinteger>(files_.size()), memory_handle {});
+            adjust_size(maps_, static_cast<uinteger>(files_.size()), std::shared_ptr<mapped_file> {});
+            adjust_size(texts_, static_cast<uinteger>(files_.size()), std::string_view {});
             adjust_size(settings_, static_cast<uinteger>(files_.size()),
                         file_settings { std::string(""), header_max_sz_ });
             adjust_size(success_, static_cast<uinteger>(files_.size()), true);
+            adjust_size(parsed_, static_cast<uinteger>(files_.size()), false);
             adjust_size(file_lines_, static_cast<uinteger>(files_.size()), {});
-            adjust_size(file_ints_, static_cast<uinteger>(files_.size()), IMap {});
-            adjust_size(file_doubles_, static_cast<uinteger>(files_.size()), DMap {});
-            adjust_size(file_strings_, static_cast<uinteger>(files_.size()), SMap {});
-            adjust_size(ints_lens_, static_cast<uinteger>(files_.size()), static_cast<uinteger>( 0 ));
-            adjust_size(doubles_lens_, static_cast<uinteger>(files_.size()), static_cast<uinteger>( 0 ));
-            adjust_size(strings_lens_, static_cast<uinteger>(files_.size()), static_cast<uinteger>( 0 ));
+            adjust_size(file_cols_, static_cast<uinteger>(files_.size()), column_table {});
             adjust_size(statistics_, static_cast<uinteger>(files_.size()), file_stats {});
+            adjust_size(kept_rows_, static_cast<uinteger>(files_.size()), indices_t {});
+            adjust_size(released_, static_cast<uinteger>(files_.size()), false);
+
+            // Shared loading pool, (re)sized to the requested thread count
+            pool_ = shared_thread_pool(options_.n_threads);
 
             Timer t;
-            if ( !this->async_get_files() ) { // Retrieve file
-                write_err_log(std::runtime_error(err_msg), "FATAL ERROR: Failed to retrieve files.");
-                return false;
-            }
-            write_log(std::format(" - Files retrieved in {} seconds.", t.elapsed()));
-            t.reset();
-            if ( !this->async_encode_adjust_files() ) {
-                // Scan & adjust file encoding if necessary
-                write_err_log(std::runtime_error(err_msg), "FATAL ERROR: Failed to adjust file encoding.");
-                return false;
-            }
-            write_log(std::format(" - Encoding adjusted in {} seconds.", t.elapsed()));
-            t.reset();
             if ( !this->async_process_files() ) {
                 // Perform all file processing required
                 write_err_log(std::runtime_error(err_msg), "FATAL ERROR: Failed to process file.");
@@ -550,9 +636,11 @@ namespace burn_in_data_report
         }
     }
 
+    // Only the new file is parsed, loaded files are merged from their cached results.
     inline bool
     file_data::add_file( const std::filesystem::directory_entry& file ) noexcept {
         try {
+            if ( read_only_ ) { throw std::runtime_error("Data opened from a column store or database is read only."); }
             files_.push_back(file);
             return recalculate_files();
         }
@@ -566,6 +654,7 @@ namespace burn_in_data_report
     file_data::add_files(
         const std::vector<std::filesystem::directory_entry>& files ) noexcept {
         try {
+            if ( read_only_ ) { throw std::runtime_error("Data opened from a column store or database is read only."); }
             files_.insert(files_.end(), files.begin(), files.end());
             return recalculate_files();
         }
@@ -575,41 +664,6 @@ namespace burn_in_data_report
         }
     }
 
-    inline bool
-    file_data::remove_file( const uinteger& file_idx ) noexcept {
-        try {
-            files_.erase(files_.begin() + file_idx);
-            return recalculate_files();
-        }
-        catch ( const std::exception& err ) {
-            write_err_log(err, "DLL: <file_data::remove_file>");
-            return false;
-        }
-    }
-
-    inline bool
-    file_data::remove_files( const std::vector<uinteger>& indexes ) noexcept {
-        try {
-            std::vector<uinteger> sorted_list { indexes };
-
-            // Sort indexes so largest at front, smallest at back
-            std::qsort(sorted_list.data(), sorted_list.size(),
-                       sizeof(uinteger), []( const void* a, const void* b ) {
-                           return static_cast<int>( *( uinteger* ) b - *( uinteger* ) a );
-                       });
-
-            // Iterate through sorted_list, removing indexes
-            for ( const auto& idx : sorted_list )
-                files_.erase(files_.begin() + idx);
-
-            return recalculate_files();
-        }
-        catch ( const std::exception& err ) {
-            write_err_log(err, "DLL: <file_data::remove_files>");
-            return false;
-        }
-    }
-
     static memory_handle
     get_file( const std::filesystem::directory_entry& _file ) noexcept {
         try {
@@ -690,64 +744,90 @@ namespace burn_in_data_report
         }
     }
 
-    inline bool
-    file_data::async_get_files() noexcept {
+    static bool
+    map_file( const std::filesystem::directory_entry& _file,
+              std::shared_ptr<mapped_file>& _map ) noexcept {
         try {
-            std::vector<std::future<memory_handle>> futures(files_.size());
-
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                futures[i] = std::async(get_file, std::cref(files_[i]));
+            if ( !_file.exists() ) {
+                _map.reset();
+                return false;
             }
 
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                if ( success_[i] ) {
-                    handles_[i] = futures[i].get();
-                    if ( !handles_[i]._data ) {
-                        failed_loads_.push_back(std::format("{}: Failed to load file.", files_[i].path().string()));
-                        success_[i] = false;
-                    }
-                }
+            auto map = std::make_shared<mapped_file>();
+            if ( !map->open(_file.path()) ) {
+                write_err_log(std::runtime_error(
+                    std::format("DLL: <file_data::map_file> Failed to map {}.", _file.path().string())));
+                _map.reset();
+                return false;
             }
 
-            if ( !check_valid_state(success_) ) { return false; }
-
+            _map = std::move(map);
             return true;
         }
         catch ( const std::exception& err ) {
-            write_err_log(err, "<file_data::async_get_files>");
+            write_err_log(err, "DLL: <file_data::map_file>");
+            _map.reset();
             return false;
         }
     }
 
-    static encoding_type
-    find_encoding_type( memory_handle& _handle ) {
-        // Set default return type & ptr for characters
-        auto result = encoding_type::UNKNOWN; // --> Assume UTF8 w/ no BOM
-        char* chars = nullptr;
+    // Bytes of the first probe read, doubled per read until the probe holds enough lines
+    constexpr uinteger probe_chunk_bytes { 64 * 1024 };
+    constexpr uinteger probe_max_bytes { 16 * 1024 * 1024 };
 
-        std::size_t max_encode_len = 0;
-        for ( const auto& value : encoding_bom | std::views::values ) {
-            if ( value.size() > max_encode_len )
-                max_encode_len = value.size();
+    /*
+    * Reads the start of _file into _probe, at least _n_lines complete lines
+    * or the whole file if it's shorter. A partial final line is cut off.
+    */
+    static bool
+    probe_file( const std::filesystem::directory_entry& _file, const uinteger& _n_lines,
+                std::string& _probe ) noexcept {
+        try {
+            _probe.clear();
+            std::ifstream stream(_file.path(), std::ios::in | std::ios::binary);
+            if ( !stream.is_open() ) { return false; }
+
+            uinteger n_lines { 0 };
+            uinteger chunk { probe_chunk_bytes };
+            while ( n_lines < _n_lines && _probe.size() < probe_max_bytes ) {
+                const std::size_t offset { _probe.size() };
+                _probe.resize(offset + chunk);
+                stream.read(_probe.data() + offset, static_cast<std::streamsize>(chunk));
+                const auto n_read { static_cast<std::size_t>(stream.gcount()) };
+                _probe.resize(offset + n_read);
+                // Whole file read
+                if ( n_read < chunk ) { return true; }
+
+                n_lines += static_cast<uinteger>(newline_scan::count(std::string_view { _probe }.substr(offset)));
+                chunk *= 2;
+            }
+
+            const auto last_newline { _probe.rfind('\n') };
+            _probe.resize(last_newline == std::string::npos ? 0 : last_newline + 1);
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <probe_file>");
+            _probe.clear();
+            return false;
         }
+    }
 
-        chars = new char[max_encode_len];
+    static encoding_type
+    find_encoding_type( const std::string_view _text ) {
+        // Set default return type --> Assume UTF8 w/ no BOM
+        auto result = encoding_type::UNKNOWN;
 
         for ( auto& [type, encode_arr] : encoding_bom ) // Iter. through types of encoding
         {
 #ifdef DEBUG
             print("- Checking encoding type: " + encoding_string.at(type), 4);
 #endif
-            _handle.get(chars, _handle._data,
-                        static_cast<uinteger>(encode_arr.size())); // get x chars to compare against
-            if ( !chars )                    // Failed break out & return default
-            {
-                break;
-            }
+            if ( _text.size() < encode_arr.size() ) { continue; }
 
             bool matching = true;
             for ( uinteger i = 0; i < encode_arr.size(); ++i ) {
-                if ( !(matching = (static_cast<unsigned>( chars[access_checked(i)] ) ==
+                if ( !(matching = (static_cast<unsigned>( _text[access_checked(i)] ) ==
                                    encode_arr[access_checked(i)])) )
                     break;
             }
@@ -759,28 +839,21 @@ namespace burn_in_data_report
             }
         }
 
-        delete[] chars;
-
         return result;
     }
 
+    /*
+    * Detects the BOM at the start of _text & steps over it. Only the
+    * view is adjusted, the underlying buffer / mapping is never copied.
+    */
     static bool
-    encode_adjust_file( encoding_type& _encoding, memory_handle& _handle ) {
-        char* tmp_data = nullptr;
+    encode_adjust_file( encoding_type& _encoding, std::string_view& _text ) {
         try {
-            _encoding = find_encoding_type(_handle);
+            _encoding = find_encoding_type(_text);
 
             if ( _encoding != encoding_type::UNKNOWN ) {
                 write_log("- Encoding found: " + encoding_string.at(_encoding) + ", adjusting..." );
-                const uinteger offset{ static_cast<uinteger>(encoding_bom.at( _encoding ).size()) };
-                tmp_data = new char[access_checked(_handle._sz - offset)];
-
-                _handle.get(tmp_data, offset, _handle._sz);
-                _handle.free();
-
-                _handle._sz -= offset;
-
-                _handle._data = tmp_data;
+                _text.remove_prefix(encoding_bom.at(_encoding).size());
             }
 
             return true;
@@ -788,118 +861,9 @@ namespace burn_in_data_report
         catch ( const std::exception& err ) {
             write_err_log(err, "DLL: <file_data::encode_adjust_file>");
             _encoding = encoding_type::UNKNOWN;
-            _handle.free();
-
-            delete[] tmp_data;
-
-            return false;
-        }
-    }
-
-    // Scan & account for encoding
-    inline bool
-    file_data::async_encode_adjust_files() noexcept {
-        try {
-            std::vector<std::future<bool>> futures(handles_.size());
-
-            for ( uinteger i { 0 }; i < handles_.size(); ++i ) {
-                if ( success_[i] ) {
-                    futures[i] = std::async(encode_adjust_file, std::ref(encodings_[i]),
-                                            std::ref(handles_[i]));
-                }
-                else {
-                    encodings_[i] = encoding_type::UNKNOWN;
-                    handles_[i].free();
-                }
-            }
-
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                if ( success_[i] ) {
-                    success_[i] = futures[i].get();
-                    if ( !success_[i] ) {
-                        failed_loads_.push_back(std::format("{}: Failed to adjust file encoding.", files_[i].path().string()));
-                    }
-                }
-            }
-
-            if ( !check_valid_state(success_) )
-                return false;
-        }
-        catch ( const std::exception& err ) {
-            write_err_log(err, "DLL: <file_data::async_encode_adjust_files>");
-            return false;
-        }
-
-        return true;
-    }
-
-    inline bool
-    file_data::async_text_to_lines() noexcept {
-        try {
-            std::vector<std::future<bool>> futures;
-
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                if ( success_[i] ) {
-                    futures.push_back(std::async(text_to_lines,
-                                                 std::string_view { handles_[i].get() },
-                                                 std::ref(file_lines_[i])));
-                }
-            }
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                if ( !futures[i].get() ) {
-                    failed_loads_.push_back(std::format("{}: Failed to convert text to lines.", files_[i].path().string()));
-                    write_log(std::format("<text_to_lines> failed for {}", files_[i].path().string()));
-                    success_[i] = false;
-                }
-            }
-
-            if ( !check_valid_state(success_) )
-                return false;
-        }
-        catch ( const std::exception& err ) {
-            write_err_log(err, "DLL: <file_data::aync_text_to_lines>");
+            _text = std::string_view {};
             return false;
         }
-
-        return true;
-    }
-
-    // Transform raw data into array of extracted data.
-    // Will eventually pass some form of settings to this.
-    // Should handle things like sensible defaults when a char
-    // which can't be converted is found.
-
-    // Also delimiters, etc.
-    inline bool
-    file_data::async_process_files() noexcept {
-        Timer t, t2;
-        if ( !async_text_to_lines() ) { return false; }
-        write_log(std::format("     - text_to_lines completed in {} seconds.", t.elapsed()));
-        t.reset();
-        // Scan for file style, e.g Starlabs .txt or normal .csv style.
-        if ( !async_parse_file_type(config_loc_) ) { return false; }
-        write_log(std::format("     - parse file parsed in {} seconds.", t.elapsed()));
-        t.reset();
-        if ( !async_header_halt_scan() ) { return false; }
-        write_log(std::format("     - header halt parsed in {} seconds.", t.elapsed()));
-        t.reset();
-        if ( !async_time_stamp_scan() ) { return false; }
-        write_log(std::format("     - time stamp parsed in {} seconds.", t.elapsed()));
-        t.reset();
-        if ( !async_column_title_scan() ) { return false; }
-        write_log(std::format("     - column titles parsed in {} seconds.", t.elapsed()));
-        write_log(std::format("   - Header info parsed in {} seconds.", t2.elapsed()));
-        t.reset();
-        if ( !async_parse_data() ) { return false; }
-        write_log(std::format("   - Data parsed in {} seconds.", t.elapsed()));
-        t2.reset();
-        t.reset();
-        if ( !async_trim_data() ) { return false; }
-        write_log(std::format("     - Data trimmed in {} seconds.", t.elapsed()));
-        if ( !async_combine_data() ) { return false; }
-        write_log(std::format("     - Data combined in {} seconds.", t.elapsed()));
-        write_log(std::format("   - Post-processing completed in {} seconds.", t2.elapsed()));
-        return true;
     }
 
     inline char*
@@ -971,27 +935,38 @@ namespace burn_in_data_report
         }
     }
 
+    /*
+    * Finds the config whose file_identifier matches a line of the header.
+    * The header is walked once through _detector's prefix trie, a config's
+    * regex then only runs on the lines its literal prefix hit.
+    */
     static bool
-    verify_configs( const std::unordered_map<std::string, nlohmann::json>& _configs,
-                    const std::vector<std::string_view>& lines,
+    verify_configs( const config_detector& _detector,
+                    const line_index& lines,
                     const uinteger& _header_lim,
-                    nlohmann::json& _result ) {
+                    std::shared_ptr<const file_schema>& _result ) {
         try {
-            for ( auto& [name, config] : _configs ) {
+            const auto hits { _detector.prefix_hits(lines, _header_lim) };
+
+            for ( const auto& [id, schema] : enumerate(_detector.schemas()) ) {
+                const auto& name { schema->name };
                 write_log(std::format("\t- Checking: {}", name));
-                std::string pattern_string;
-                try {
-                    pattern_string = config.at("file_identifier").get<std::string>();
-                }
-                catch ( [[maybe_unused]] const std::exception& err ) {
-                    write_log(std::format("DLL: <verify_configs> Invalid config detected -> {}", name));
-                    continue;
-                }
+
+                const auto matches =
+                    [&]() -> bool {
+                        if ( schema->identifier_prefix.empty() ) {
+                            uinteger x { _header_lim };
+                            return line_check(lines, *schema->file_identifier, x);
+                        }
+                        return std::ranges::any_of(hits[id], [&]( const uinteger& _line ) {
+                            return line_check(lines[_line], *schema->file_identifier);
+                        });
+                    };
 
                 try {
-                    if ( uinteger x{ _header_lim }; line_check(lines, pattern_string, x) ) {
+                    if ( matches() ) {
                         write_log(std::format("\t\t- Config matched: {}", name));
-                        _result = config;
+                        _result = schema;
                         return true;
                     }
                     else {
@@ -1004,7 +979,7 @@ namespace burn_in_data_report
             }
 
             write_log("No matching config found.");
-            _result = nlohmann::json::parse("{}");
+            _result.reset();
             return false;
         }
         catch ( const std::exception& err ) {
@@ -1013,221 +988,82 @@ namespace burn_in_data_report
         }
     }
 
+    /*
+    * Compiled configs found at _configPath, keyed by config name. Served by
+    * the location's config_catalog: files are parsed once per process &
+    * only re-read once their size or last write time changes. Invalid
+    * configs & those with a duplicate name are logged & skipped.
+    */
     static bool
-    retrieve_ext_configs( const std::filesystem::path& _configPath,
-                          std::vector<nlohmann::json>& _storage ) {
-        try {
-            bool result = false;
-
-            _storage = {};
-            const std::filesystem::directory_entry _configLocation(_configPath);
-            const std::string path { _configPath.string() };
-
-            if ( !_configLocation.exists() ) {
-                print("WARNING: <retrieve_ext_configs> No external config location found.",
-                      4);
-                return true;
-            }
-
-            if ( _configLocation.is_directory() ) {
-                for ( auto& entry : std::filesystem::directory_iterator(_configLocation) ) {
-                    const auto filename { entry.path().string() };
-                    if ( const auto f_extension_pos { filename.rfind('.') }; f_extension_pos == std::string::npos ) { }
-                    else if ( const auto extension { filename.substr(f_extension_pos, filename.length()) };
-                        extension == ".json" ) {
-                        nlohmann::json config;
-                        if ( parse_json(entry, config) ) {
-                            _storage.push_back(config);
-                        }
-                    }
-                }
-
-                return true;
-            }
-            if ( _configLocation.is_regular_file() &&
-                 path.substr(path.rfind('.'), path.length()) == ".json" ) {
-                nlohmann::json config;
-                if ( parse_json(_configPath, config) ) { _storage = { config }; }
-
-                return true;
-            }
-            write_err_log(std::runtime_error("DLL: <retrieve_ext_configs> Invalid config location received."));
-            return false;
-        }
-        catch ( const std::exception& err ) {
-            write_err_log(err, "DLL: <retrieve_ext_configs>");
-            _storage.clear();
-            return false;
-        }
-    }
-
-    inline bool
-    file_data::async_parse_file_type( const std::filesystem::path& _configPath ) {
+    collect_configs( const std::filesystem::path& _configPath, schema_map& _schemas ) noexcept {
         try {
-            std::unordered_map<std::string, nlohmann::json> potential_configs {};
-            std::vector<nlohmann::json> ext_configs;
-
-            // Retrieve configs
-            if ( !retrieve_ext_configs(_configPath, ext_configs) ) {
-                write_err_log(std::runtime_error("DLL: <file_data::async_parse_file_type> \"retrieve_ext_configs\" failed"));
-                return false;
-            }
-
-            // Add read in configs to defaults
-            for ( auto& config : ext_configs ) {
-                try {
-                    std::string config_name = config.at("name");
-                    if ( !potential_configs.contains(config_name) ) { potential_configs[config_name] = config; }
-                    else {
-                        write_err_log(std::runtime_error("DLL: <file_data::async_parse_file_type> namespace collision in config files."));
-                    }
-                }
-                catch ( const std::exception& err ) {
-                    write_err_log(err, "DLL: <file_data::async_parse_file_type> Invalid config file.");
-                }
-            }
-
-            std::vector<std::future<bool>> futures(files_.size());
-            std::vector<nlohmann::json> configs(files_.size());
-
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                if ( success_[i] ) {
-                    futures[i] =
-                        std::async(
-                            verify_configs,
-                            std::cref(potential_configs), std::cref(file_lines_[i]),
-                            std::cref(settings_[i].get_headermaxlim()), std::ref(configs[i])
-                        );
-                }
-            }
-
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                if ( success_[i] ) {
-                    if ( !futures[i].get() ) {
-                        failed_loads_.push_back(std::format("{}: Failed to parse file type.", files_[i].path().string()));
-                        write_log(std::format("<parse_file_type> failed to parse {}", files_[i].path().string()));
-                        success_[i] = false;
-                    }
-                    else {
-                        settings_[i].set_config(configs[i]);
-                        settings_[i].set_format(FileFormat(configs[i].at("name"), configs[i]));
-                    }
-                }
-            }
-
-            if ( !check_valid_state(success_) ) {
+            _schemas.clear();
+            if ( !shared_config_catalog(_configPath)->refresh(_schemas) ) {
+                write_err_log(std::runtime_error("DLL: <collect_configs> \"config_catalog::refresh\" failed"));
                 return false;
             }
 
             return true;
         }
         catch ( const std::exception& err ) {
-            write_err_log(err, "DLL: <file_data::async_parse_file_type>");
-            return false;
-        }
-    }
-
-    inline bool
-    file_data::async_header_halt_scan() noexcept {
-        try {
-            std::vector<std::future<bool>> futures(files_.size());
-            std::vector<uinteger> header_lims(files_.size());
-
-            // Launch thread checking for header limit of each file.
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                // Only continue if sucessfully loaded so far
-                if ( success_[i] ) {
-                    // get config -> regex pattern & get maximum header limit set in
-                    // spreadsheet.
-                    nlohmann::json config = settings_[i].get_config();
-                    auto pattern = std::regex(config.at("header_identifier"));
-                    header_lims[i] = settings_[i].get_headermaxlim();
-
-                    futures[i] =
-                        std::async(
-                            static_cast<bool(*)(const std::vector<std::string_view>&, const std::regex&, uinteger&)>(line_check),
-                            std::cref(file_lines_[i]), pattern, std::ref(header_lims[i])
-                        );
-                }
-            }
-
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                if ( success_[i] ) {
-                    // Set header limit to start of data
-                    if ( futures[i].get() ) {
-                        settings_[i].set_header_lim(header_lims[i] + 1);
-                    }
-                    // process failed
-                    else {
-                        failed_loads_.push_back(std::format("{}: Failed to parse header info.", files_[i].path().string()));
-                        write_log(std::format("<header_halt_scan> failed in {}", files_[i].path().string()));
-                        settings_[i].set_header_lim(0);
-                        success_[i] = false;
-                    }
-                }
-            }
-
-            if ( !check_valid_state(success_) )
-                return false;
-
-            return true;
-        }
-        catch ( const std::exception& err ) {
-            write_err_log(err, "DLL: <file_data::async_header_halt_scan>");
+            write_err_log(err, "DLL: <collect_configs>");
             return false;
         }
     }
 
     static bool
     time_stamp_scan( const std::filesystem::directory_entry& file,
-                     const std::vector<std::string_view>& lines,
+                     const line_index& lines,
                      file_settings& settings ) noexcept {
         try {
             const auto file_write_time =
                 std::chrono::sys_time<nano>{ get_file_write_time<nano>(file) };
             settings.set_last_write(file_write_time);
 
-            std::string method = settings.get_config().at("start_time").at("method");
-            auto& params = settings.get_config().at("start_time").at("params");
+            const file_schema& schema { settings.get_schema() };
             std::vector<std::string> start_matches, increment_matches;
 
             // get test start time
-            if ( method == "in_header" ) {
-                const std::regex start_pattern = params.at("re_pattern");
-                if ( line_capture(lines, start_matches, start_pattern,
+            switch ( schema.start_method ) {
+            case time_method::in_header: {
+                if ( line_capture(lines, start_matches, *schema.start_pattern,
                                   settings.get_header_lim()) ) {
                     assert(start_matches.size() == 2);
                     const std::chrono::sys_time<nano> start_time =
-                        time_format(start_matches[1], std::string { params.at("time_pattern") },
+                        time_format(start_matches[1], schema.start_time_parser,
                                     std::chrono::system_clock::time_point {});
                     settings.set_start_time(start_time);
                 }
+                break;
             }
-            else if ( method == "in_file_path" ) {
-                const std::regex start_pattern = params.at("re_pattern");
+            case time_method::in_file_path: {
                 std::smatch match;
                 std::string path_str { file.path().string() };
-                if ( std::regex_search(path_str, match, start_pattern) ) {
+                if ( std::regex_search(path_str, match, *schema.start_pattern) ) {
                     const std::chrono::sys_time<nano> start_time =
-                        time_format(match.str(), std::string { params.at("time_pattern") },
+                        time_format(match.str(), schema.start_time_parser,
                                     std::chrono::system_clock::time_point{});
                     settings.set_start_time(start_time);
                 }
+                break;
             }
-            else if ( method == "in_data" ) {
-                // Parse start time from first line of data
-                const auto& delim{ settings.get_config().at("delim").get<std::string>() };
-                const auto& data{ lines[settings.get_header_lim()] };
-                const auto& split_data{ split_str(data, delim) };
-                const auto& start_time_str{ trim(split_data[params.at("col_index").get<uinteger>()]) };
+            case time_method::in_data: {
+                // Parse start time from field start_col_index of the first line of data
+                std::string_view field { lines.content(settings.get_header_lim()) };
+                for ( uinteger i { 0 }; i < schema.start_col_index; ++i ) {
+                    const auto delim { std::ranges::find_if(field, schema.delim) };
+                    field = delim == field.end() ? std::string_view {} : field.substr(delim - field.begin() + 1);
+                }
+                field = field.substr(0, static_cast<std::size_t>(std::ranges::find_if(field, schema.delim) - field.begin()));
 
                 settings.set_start_time(
-                    time_format(start_time_str, params.at("time_pattern").get<std::string>(),
+                    time_format(trim_view(field), schema.start_time_parser,
                         std::chrono::system_clock::time_point{}
                     )
                 );
+                break;
             }
-            else {
+            default:
                 // Some sort of failure
                 throw std::runtime_error("<time_stamp_scan> Unknown test start time scanning method.");
             }
@@ -1235,42 +1071,33 @@ namespace burn_in_data_report
             write_log(std::format("Finished, start time: {}.\n", settings.get_start_time()));
 #endif
 
-            method = settings.get_config().at("interval").at("method").get<std::string>();
-            params = settings.get_config().at("interval").at("params");
-
 #ifdef DEBUG
             write_log("Checking interval:\n");
 #endif
             // get interval period
-            if ( method == "in_header" ) {
-                const std::regex incr_pattern{ params.at("re_pattern").get<std::string>() };
-                if ( line_capture(lines, increment_matches, incr_pattern,
+            switch ( schema.interval_method ) {
+            case time_method::in_header: {
+                if ( line_capture(lines, increment_matches, *schema.interval_pattern,
                                   settings.get_header_lim()) ) {
                     const nano incr_time =
-                        time_format(increment_matches[1],
-                                    std::string { params.at("time_pattern") }, nano::zero());
+                        time_format(increment_matches[1], schema.interval_time_parser, nano::zero());
                     settings.set_measurement_period(incr_time);
                 }
+                break;
             }
-            else if ( method == "value" ) {
-                using seconds = std::chrono::duration<double, std::ratio<1i64>>;
-                const seconds incr_time { params.at("increment").get<double>() };
-                settings.set_measurement_period(std::chrono::duration_cast<nano>(incr_time));
-            }
-            else if ( method == "automatic" ) {
-                if ( !is_in(params.at("title").get<std::string>(),
-                            settings.get_config().at("titles").get<std::vector<std::string>>()) ) {
-                    throw std::runtime_error("Invalid title parsed in configuration file to automatically detect measurement interval.");
-                }
+            case time_method::value:
+                settings.set_measurement_period(schema.interval_increment);
+                break;
+            case time_method::automatic:
                 // Data hasn't been read in yet, interval is detected in parsing step
-            }
-            else {
+                break;
+            default:
                 throw std::runtime_error(
-                    std::format("Invalid \"interval\" method: \"{}\" received. Check for mistakes in {} configuration.",
-                    method, settings.get_config().at("name").get<std::string>()) );
+                    std::format("Invalid \"interval\" method received. Check for mistakes in {} configuration.",
+                    schema.name) );
             }
 #ifdef DEBUG
-            if ( method != "automatic" ) {
+            if ( schema.interval_method != time_method::automatic ) {
                 write_log(std::format("Success, interval: {}.\n", settings.get_measurement_period()));
             }
             else { write_log("Automatic detection, interval checking postponed.\n"); }
@@ -1284,58 +1111,15 @@ namespace burn_in_data_report
         }
     }
 
-    inline bool
-    file_data::async_time_stamp_scan() noexcept {
-        try {
-            std::vector<std::future<bool>> future(files_.size());
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                if ( success_[i] ) {
-                    future[i] =
-                        std::async(time_stamp_scan, std::cref(files_[i]),
-                                   std::cref(file_lines_[i]), std::ref(settings_[i]));
-                }
-            }
-
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                if ( success_[i] ) {
-                    if ( !future[i].get() ) {
-                        failed_loads_.push_back(std::format("{}: Failed to parse time stamps.", files_[i].path().string()));
-                        write_log(std::format("<time_stamp_scan> failed in {}", files_[i].path().string()));
-                        success_[i] = false;
-                    }
-                }
-            }
-
-            if ( !check_valid_state(success_) )
-                return false;
-        }
-        catch ( const std::exception& err ) {
-            write_err_log(err, "DLL: <file_data::async_time_stamp_scan>");
-            return false;
-        }
-
-        return true;
-    }
-
     static bool
-    column_title_scan( const std::vector<std::string_view>& lines,
+    column_title_scan( const line_index& lines,
                        file_settings& settings ) noexcept {
         try {
-            const std::vector<std::string> cols = settings.get_config().at("titles");
-            auto col_types =
-                settings.get_config().at("types").get<std::vector<DataType>>();
-
-            if ( cols.size() != col_types.size() ) {
-                throw
-                    std::runtime_error("Length mismatch between \"titles\" and \"types\" parameters in configuration file.");
-            }
-            // Add [title, type] pairs to type map in Settings object
-            /*for ( uinteger i = 0; i < cols.size(); ++i ) { */
-            for ( const auto& [i, col_title] : enumerate(cols) ) {
-                settings.col_types()[col_title] = col_types[i];
-                settings.col_order()[col_title] = static_cast<uinteger>(i);
-            }
-            settings.set_n_cols(static_cast<uinteger>(cols.size()));
+            // Titles & types were validated when the config was compiled
+            const file_schema& schema { settings.get_schema() };
+            settings.set_col_types(schema.col_types);
+            settings.set_col_order(schema.col_order);
+            settings.set_n_cols(static_cast<uinteger>(schema.columns.size()));
 
             return true;
         }
@@ -1345,229 +1129,265 @@ namespace burn_in_data_report
         }
     }
 
-    inline bool
-    file_data::async_column_title_scan() noexcept {
-        try {
-            std::vector<std::future<bool>> futures(files_.size());
+    // Data rows per parse_data chunk, files with more rows are parsed in parallel
+    constexpr uinteger parse_chunk_rows { 65536 };
+
+    // A column being parsed: its field position, type & destination
+    struct column_parser
+    {
+        const std::string*        title;
+        uinteger                  idx;
+        DataType                  type;
+        std::vector<integer>*     ints;
+        std::vector<double>*      doubles;
+        string_column*            strings;
+        uinteger                  failures;
+        const time_parser*        datetime { nullptr }; // Datetime column, cells are read as ns since epoch
+    };
 
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                if ( success_[i] ) {
-                    futures[i] = std::async(column_title_scan, std::cref(file_lines_[i]),
-                                            std::ref(settings_[i]));
+    /*
+    * Parses data lines [_first, _last) into _parsers, which must be sorted by
+    * field position (it acts as the position -> column table). Each line is
+    * walked once & its fields go straight to their columns, no per row
+    * allocation. Short rows are treated as empty cells.
+    */
+    static void
+    parse_rows( const line_index& _lines, const delimiter_table& _is_delim,
+                std::vector<column_parser>& _parsers, const uinteger& _first, const uinteger& _last ) {
+        const auto store = []( column_parser& parser, const std::string_view val ) {
+            switch ( parser.type ) {
+            case DataType::INTEGER: {
+                integer _integer { 0 };
+                bool    parsed;
+                if ( parser.datetime ) {
+                    int64_t ns { 0 };
+                    parsed = parser.datetime->parse_time_point(trim_view(val), ns);
+                    _integer = static_cast<integer>(ns);
                 }
+                else { parsed = parse_cell(val, _integer); }
+                if ( !parsed ) { ++parser.failures; }
+                parser.ints->emplace_back(_integer);
+                break;
+            }
+            case DataType::DOUBLE: {
+                double _double { 0.0 };
+                if ( !parse_cell(val, _double) ) { ++parser.failures; }
+                parser.doubles->emplace_back(_double);
+                break;
+            }
+            case DataType::STRING:
+                parser.strings->push_back(trim_view(val));
+                break;
+            case DataType::NONE:
+                parser.strings->push_back("");
             }
+        };
 
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                if ( success_[i] ) {
-                    if ( !futures[i].get() ) {
-                        failed_loads_.push_back(std::format("{}: Failed to parse column titles.", files_[i].path().string()));
-                        write_log(std::format("<column_title_scan> failed in {}", files_[i].path().string()));
-                        success_[i] = false;
-                    }
+        for ( uinteger i { _first }; i < _last; ++i ) {
+            const std::string_view line { _lines.content(i) };
+            const char*            field_start { line.data() };
+            const char* const      line_end { line.data() + line.size() };
+
+            std::size_t next { 0 };
+            uinteger    field { 0 };
+            while ( next < _parsers.size() ) {
+                const char* field_end { field_start };
+                while ( field_end != line_end && !_is_delim(*field_end) ) { ++field_end; }
+
+                while ( next < _parsers.size() && _parsers[next].idx == field ) {
+                    store(_parsers[next++], std::string_view {
+                              field_start, static_cast<std::size_t>(field_end - field_start)
+                          });
                 }
+
+                if ( field_end == line_end ) { break; }
+                field_start = field_end + 1;
+                ++field;
             }
 
-            if ( !check_valid_state(success_) )
-                return false;
-        }
-        catch ( const std::exception& err ) {
-            write_err_log(err, "DLL: <file_data::async_column_title_scan>");
-            return false;
+            for ( ; next < _parsers.size(); ++next ) { store(_parsers[next], std::string_view {}); }
         }
+    }
 
-        return true;
+    // Per file max / min / n of one parsed column
+    static void
+    set_column_stats( const std::string& _title, const column_id& _id, const column_table& _cols,
+                      file_stats& _stats ) {
+        switch ( _cols.type(_id) ) {
+        case DataType::STRING:
+            _stats.max_strings[_title] = std::numeric_limits<double>::signaling_NaN();
+            _stats.min_strings[_title] = std::numeric_limits<double>::signaling_NaN();
+            _stats._n[_title] = { static_cast<integer>(_cols.rows(_id)) };
+            break;
+        case DataType::INTEGER: {
+            const auto& data { _cols.get<integer>(_id) };
+            _stats.max_ints[_title] = check_max(data);
+            _stats.min_ints[_title] = check_min(data);
+            _stats._n[_title] = { static_cast<integer>(data.size()) };
+            break;
+        }
+        case DataType::DOUBLE: {
+            const auto& data { _cols.get<double>(_id) };
+            _stats.max_doubles[_title] = check_max(data);
+            _stats.min_doubles[_title] = check_min(data);
+            _stats._n[_title] = { static_cast<integer>(data.size()) };
+            break;
+        }
+        case DataType::NONE:
+            break;
+        }
     }
 
+    /*
+    * Parses the data rows of a file into cols, by the schema's column ids.
+    * Only columns _options parses & the schema's required columns are
+    * parsed, the rest are left out of the table to be parsed on request.
+    */
     static bool
-    parse_data( const std::vector<std::string_view>& lines,
-                file_settings& settings, IMap& ints, uinteger& ints_len,
-                DMap& doubles, uinteger& doubles_len, SMap& strings,
-                uinteger& strings_len, file_stats& statistics ) noexcept {
+    parse_data( const line_index& lines,
+                file_settings& settings, column_table& cols, file_stats& statistics,
+                const load_options& _options = {},
+                thread_pool* pool = nullptr ) noexcept {
         try {
 #ifdef DEBUG
             print("- <parse_data>:\n", 3);
 #endif
-            nlohmann::json config = settings.get_config();
-            const auto& col_types = settings.col_types();
-            const std::string delim { config.at("delim").get<std::string>() };
+            const file_schema& schema { settings.get_schema() };
+            const auto& col_types = settings.get_col_types();
+
+            const auto wanted =
+                [&_options, &schema]( const std::string& _title ) {
+                    return _options.parses(_title) || schema.required.contains(_title);
+                };
 
 #ifdef DEBUG
             print("- Allocating storage.", 3);
 #endif
-            // Prepare storage to emplace_back values efficiently
-            for ( auto& [key, type] : col_types ) {
-                if ( key == "Combined Time" ) { continue; }
+            // Prepare storage to emplace_back values efficiently. Every column is added
+            // before any destination is taken, adding may move the table's columns.
+            for ( const auto& column : schema.columns ) {
+                if ( column.title == "Combined Time" || !wanted(column.title) ) { continue; }
 
-                switch ( type ) {
-                case DataType::INTEGER:
-                    ints[key].clear();
-                    ints[key].reserve(lines.size() - settings.get_header_lim());
-                    break;
-                case DataType::DOUBLE:
-                    doubles[key].clear();
-                    doubles[key].reserve(lines.size() - settings.get_header_lim());
-                    break;
-                case DataType::STRING:
-                    strings[key].clear();
-                    strings[key].reserve(lines.size() - settings.get_header_lim());
-                    break;
-                case DataType::NONE:
-                    strings[key].clear();
-                    strings[key].reserve(lines.size() - settings.get_header_lim());
+                if ( column.type == DataType::NONE ) {
                     write_err_log(std::runtime_error("DLL: <parse_data> None type encountered while parsing."));
-                    break;
                 }
+                std::visit([&lines, &settings]( auto& _values ) {
+                    _values.clear();
+                    _values.reserve(lines.size() - settings.get_header_lim());
+                }, cols.add(column.id, column.type).values);
             }
 
 #ifdef DEBUG
             print("- Parsing file.", 3);
 #endif
-            // Iterate through data lines
-            for ( uinteger i { settings.get_header_lim() }; i < lines.size(); ++i ) {
-                const std::vector<std::string_view> values = split_str(lines[i], delim);
-
-                for ( const auto& [col_title, idx] : settings.col_order() ) {
-                    if ( col_title == "Combined Time" ) { continue; }
-
-                    const auto col_type{ settings.get_type(col_title) };
-                    const auto& val{ values[idx]};
-
-                    char buf[MAX_LINE_LENGTH];
-                    // sscanf, which is used to parse values in further on, automatically
-                    // trims whitespace at start & finish.
-                    if ( col_type != DataType::STRING ) {
-                        memcpy_s(buf, MAX_LINE_LENGTH,
-                                 val.data(), val.size());
-
-                        if ( val.size() < MAX_LINE_LENGTH )
-                            buf[val.size()] = '\0';
-                        else
-                            buf[MAX_LINE_LENGTH - 1] = '\0';
-                    }
+            // The schema's columns are already in field order, only destinations are resolved here
+            std::vector<column_parser> parsers;
+            for ( const auto& column : schema.columns ) {
+                if ( column.title == "Combined Time" || !wanted(column.title) ) { continue; }
+
+                auto& values { cols.at(column.id).values };
+                column_parser parser {
+                    &column.title, column.idx, column.type, std::get_if<std::vector<integer>>(&values),
+                    std::get_if<std::vector<double>>(&values), std::get_if<string_column>(&values), 0
+                };
+                if ( column.datetime ) { parser.datetime = &*column.datetime; }
+                parsers.push_back(parser);
+            }
 
-                    // Scan values in
-                    int sscanf_return_val { 0 };
-                    switch ( col_type ) {
-                    case DataType::INTEGER: {
-                        integer _integer { 0 };
-                        sscanf_return_val =
-                            sscanf_s(buf, fmt, &_integer);
-                        ints[col_title].emplace_back(_integer);
-                        break;
-                    }
-                    case DataType::DOUBLE: {
-                        double _double { 0.0 };
-                        sscanf_return_val =
-                            sscanf_s(buf, "%lf", &_double);
-                        doubles[col_title].emplace_back(_double);
-                        break;
-                    }
-                    case DataType::STRING:
-                        strings[col_title].emplace_back(trim(val));
-                        break;
-                    case DataType::NONE:
-                        strings[col_title].emplace_back("");
-                    }
+            const delimiter_table& is_delim { schema.delim };
+            const uinteger first_row { settings.get_header_lim() };
+            const uinteger n_data_rows { lines.size() > first_row ? lines.size() - first_row : 0 };
+            const uinteger n_chunks { (n_data_rows + parse_chunk_rows - 1) / parse_chunk_rows };
 
-                    // TODO: Add some error handling
-                    /*if ( sscanf_return_val == EOF ||
-                         sscanf_return_val == EINVAL ) {}*/
-                }
+            if ( pool == nullptr || pool->size() < 2 || n_chunks < 2 ) {
+                parse_rows(lines, is_delim, parsers, first_row, lines.size());
             }
-
-            const auto set_max =
-                []( const IMap& _ints, const DMap& _doubles,
-                    const file_settings& _settings, file_stats& _stats ) {
-                const auto title_type_vec = _settings.get_col_types();
-                for ( const auto& title_type : title_type_vec ) {
-                    switch ( title_type.second ) {
-                    case DataType::STRING: {
-                        _stats.max_strings[title_type.first] =
-                            std::numeric_limits<double>::signaling_NaN();
-                        break;
-                    }
-                    case DataType::INTEGER: {
-                        const auto& data = _ints.at(title_type.first);
-                        _stats.max_ints[title_type.first] = check_max(data);
-                        break;
-                    }
-                    case DataType::DOUBLE: {
-                        const auto& data = _doubles.at(title_type.first);
-                        _stats.max_doubles[title_type.first] = check_max(data);
-                        break;
-                    }
-                    case DataType::NONE: {}
-                        break;
+            else {
+                /*
+                * Large file: the line index already splits the data at
+                * newlines, so each chunk of rows after the first is parsed on
+                * its own task (of this file's task_group) into chunk owned
+                * columns, while the first is parsed inline straight into the
+                * destination columns. Chunks are then appended in file order
+                * & their failures summed, a chunk's string codes are mapped
+                * to the destination's.
+                */
+                struct parse_chunk
+                {
+                    std::vector<column_parser>        parsers;
+                    std::vector<std::vector<integer>> ints;
+                    std::vector<std::vector<double>>  doubles;
+                    std::vector<string_column>        strings;
+                };
+                std::vector<parse_chunk> chunks(n_chunks - 1);
+                task_group group { *pool };
+
+                for ( uinteger c { 1 }; c < n_chunks; ++c ) {
+                    const uinteger first { first_row + c * parse_chunk_rows };
+                    const uinteger last { MIN(first + parse_chunk_rows, lines.size()) };
+
+                    auto& chunk { chunks[c - 1] };
+                    chunk.ints.resize(parsers.size());
+                    chunk.doubles.resize(parsers.size());
+                    chunk.strings.resize(parsers.size());
+                    chunk.parsers = parsers;
+                    for ( uinteger k { 0 }; k < parsers.size(); ++k ) {
+                        auto& parser { chunk.parsers[k] };
+                        parser.failures = 0;
+                        if ( parser.ints ) { parser.ints = &chunk.ints[k]; }
+                        if ( parser.doubles ) { parser.doubles = &chunk.doubles[k]; }
+                        if ( parser.strings ) { parser.strings = &chunk.strings[k]; }
+                        chunk.ints[k].reserve(parser.ints ? last - first : 0);
+                        chunk.doubles[k].reserve(parser.doubles ? last - first : 0);
+                        chunk.strings[k].reserve(parser.strings ? last - first : 0);
                     }
+
+                    group.run([&lines, &is_delim, &chunk, first, last] {
+                        parse_rows(lines, is_delim, chunk.parsers, first, last);
+                    });
                 }
-            };
-            const auto set_min =
-                []( const IMap& _ints, const DMap& _doubles,
-                    const file_settings& _settings, file_stats& _stats ) {
-                const auto title_type_vec = _settings.get_col_types();
-                for ( const auto& [title, type] : title_type_vec ) {
-                    switch ( type ) {
-                    case DataType::STRING: {
-                        _stats.min_strings[title] =
-                            std::numeric_limits<double>::signaling_NaN();
-                        break;
-                    }
-                    case DataType::INTEGER: {
-                        const auto& data = _ints.at(title);
-                        _stats.min_ints[title] = check_min(data);
-                        break;
-                    }
-                    case DataType::DOUBLE: {
-                        const auto& data = _doubles.at(title);
-                        _stats.min_doubles[title] = check_min(data);
-                        break;
-                    }
-                    case DataType::NONE: {}
-                        break;
+
+                /*
+                * The group's destructor lets the other chunks finish if the
+                * first throws. wait() only helps with this file's chunks,
+                * never another file's task.
+                */
+                parse_rows(lines, is_delim, parsers, first_row, first_row + parse_chunk_rows);
+                group.wait();
+
+                for ( auto& chunk : chunks ) {
+                    for ( uinteger k { 0 }; k < parsers.size(); ++k ) {
+                        auto& parser { parsers[k] };
+                        parser.failures += chunk.parsers[k].failures;
+                        if ( parser.ints ) {
+                            parser.ints->insert(parser.ints->end(), chunk.ints[k].begin(), chunk.ints[k].end());
+                        }
+                        if ( parser.doubles ) {
+                            parser.doubles->insert(parser.doubles->end(), chunk.doubles[k].begin(),
+                                                   chunk.doubles[k].end());
+                        }
+                        if ( parser.strings ) { parser.strings->append(std::move(chunk.strings[k])); }
                     }
+                    // Merged, release the chunk's columns
+                    chunk = parse_chunk {};
                 }
-            };
-            const auto set_n =
-                []( const IMap& _ints, const DMap& _doubles,
-                    const SMap& _strings, const file_settings& _settings,
-                    file_stats& _stats ) {
-                const auto title_type_vec { _settings.get_col_types() };
-                for ( const auto& title_type : title_type_vec ) {
-                    switch ( title_type.second ) {
-                    case DataType::STRING:
-                        _stats._n[title_type.first] = {
-                                static_cast<integer>( _strings.at(title_type.first).size() )
-                            };
-                        break;
-                    case DataType::INTEGER:
-                        _stats._n[title_type.first] = {
-                                static_cast<integer>( _ints.at(title_type.first).size() )
-                            };
-                        break;
-                    case DataType::DOUBLE:
-                        _stats._n[title_type.first] = {
-                                static_cast<integer>( _doubles.at(title_type.first).size() )
-                            };
-                        break;
-                    }
+            }
+
+            for ( const auto& parser : parsers ) {
+                statistics.parse_failures[*parser.title] = parser.failures;
+                if ( parser.failures > 0 ) {
+                    write_log(std::format("<parse_data> {} value(s) in column \"{}\" failed to parse, stored as 0.",
+                                          parser.failures, *parser.title));
                 }
-            };
+            }
 
-            std::future<void> launch_max =
-                std::async(set_max, std::cref(ints), std::cref(doubles),
-                           std::cref(settings), std::ref(statistics));
-            std::future<void> launch_min =
-                std::async(set_min, std::cref(ints), std::cref(doubles),
-                           std::cref(settings), std::ref(statistics));
-            std::future<void> launch_n =
-                std::async(set_n, std::cref(ints), std::cref(doubles), std::cref(strings),
-                           std::cref(settings), std::ref(statistics));
-
-            if ( std::string method = settings.get_config().at("interval").at("method");
-                method == "automatic" ) {
-                const std::string title{
-                    settings.get_config().at("interval").at("params").at("title").get<std::string>()
-                };
+            // Stats of the merged columns
+            for ( const auto& column : schema.columns ) {
+                if ( cols.contains(column.id) ) { set_column_stats(column.title, column.id, cols, statistics); }
+            }
+
+            if ( schema.interval_method == time_method::automatic ) {
+                const std::string& title { schema.interval_title };
                 /*
                 * Title isn't in file?? This should have already been filtered out
                 * but just in case.
@@ -1608,16 +1428,17 @@ namespace burn_in_data_report
                         return std::sqrt(sum / static_cast<double>( data.size() - 1 ));
                     };
 
+                const column_id id { column_ids::find(title) };
                 double mean { 0 }, std { 0 };
                 switch ( col_types.at(title) ) {
                 case DataType::INTEGER: {
-                    const auto& data = ints.at(title);
+                    const auto& data = cols.get<integer>(id);
                     mean = avg_diff(data);
                     std = std_diff(data, mean);
                     break;
                 }
                 case DataType::DOUBLE: {
-                    const auto& data = doubles.at(title);
+                    const auto& data = cols.get<double>(id);
                     mean = avg_diff(data);
                     std = std_diff(data, mean);
                     break;
@@ -1641,41 +1462,21 @@ namespace burn_in_data_report
                 }
             }
 
-            ints_len = 0;
-            doubles_len = 0;
-            strings_len = 0;
-            for ( auto& val : ints | std::views::values ) {
-                val.shrink_to_fit();
-                uinteger x = static_cast<uinteger>(val.size());
-                if ( ints_len == 0 )
-                    ints_len = x;
-                assert(x == ints_len);
-            }
-            for ( auto& val : doubles | std::views::values ) {
-                val.shrink_to_fit();
-                uinteger x =  static_cast<uinteger>(val.size());
-                if ( doubles_len == 0 )
-                    doubles_len = x;
-                assert(x == doubles_len);
-            }
-            for ( auto& val : strings | std::views::values ) {
-                val.shrink_to_fit();
-                uinteger x = static_cast<uinteger>(val.size());
-                if ( strings_len == 0 )
-                    strings_len = x;
-                assert(x == strings_len);
-            }
-
-            uinteger max_val = (ints_len >= doubles_len)
-                                   ? ints_len
-                                   : doubles_len;
-            max_val = (max_val >= strings_len)
-                          ? max_val
-                          : strings_len;
-
-            if ( !ints.empty() && ints_len != max_val ||
-                 !doubles.empty() && doubles_len != max_val ||
-                 !strings.empty() && strings_len != max_val ) {
+            // Every column holds one value per data row
+            uinteger max_val { 0 };
+            bool     first { true }, mismatch { false };
+            cols.for_each([&]( const column_id&, column_table::column& _col ) {
+                const auto len {
+                    std::visit([]( auto& _values ) {
+                        _values.shrink_to_fit();
+                        return static_cast<uinteger>(_values.size());
+                    }, _col.values)
+                };
+                mismatch |= !first && len != max_val;
+                max_val = first ? len : MAX(max_val, len);
+                first = false;
+            });
+            if ( mismatch ) {
                 throw std::runtime_error { "ERROR: <parse_data> Size mismatch between columns." };
             }
 
@@ -1683,11 +1484,8 @@ namespace burn_in_data_report
             print("Row count: " + std::to_string(max_val), 2);
 #endif
 
-            settings.set_n_rows(max_val);
-
-            launch_max.get();
-            launch_min.get();
-            launch_n.get();
+            // Nothing projected (& nothing required), the rows still count
+            settings.set_n_rows(parsers.empty() ? n_data_rows : max_val);
 
             return true;
         }
@@ -1697,46 +1495,10 @@ namespace burn_in_data_report
         }
     }
 
-    inline bool
-    file_data::async_parse_data() noexcept {
-        try {
-            std::vector<std::future<bool>> futures(files_.size());
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                if ( success_[i] ) {
-                    futures[i] =
-                        std::async(parse_data, std::cref(file_lines_[i]),
-                                   std::ref(settings_[i]), std::ref(file_ints_[i]),
-                                   std::ref(ints_lens_[i]), std::ref(file_doubles_[i]),
-                                   std::ref(doubles_lens_[i]), std::ref(file_strings_[i]),
-                                   std::ref(strings_lens_[i]), std::ref(statistics_[i]));
-                }
-            }
-            for ( uinteger i = 0; i < files_.size(); ++i ) {
-                if ( success_[i] ) {
-                    if ( !futures[i].get() ) {
-                        failed_loads_.push_back(std::format("{}: Failed to parse data.", files_[i].path().string()));
-                        write_log(std::format("<parse_data> failed in {}", files_[i].path().string()));
-                        success_[i] = false;
-                    }
-                }
-            }
-
-            if ( !check_valid_state(success_) )
-                return false;
-
-            return true;
-        }
-        catch ( const std::exception& err ) {
-            write_err_log(err, "DLL: <file_data::async_parse_data>");
-            return false;
-        }
-    }
-
     static bool
     trim_data( file_settings& settings, const bool trim_data,
-               const file_stats& statistics, IMap& ints, uinteger& ints_len,
-               DMap& doubles, uinteger& doubles_len, SMap& strings,
-               uinteger& strings_len, const nano& max_off_time ) noexcept {
+               const file_stats& statistics, column_table& cols,
+               const nano& max_off_time, indices_t& kept_rows ) noexcept {
         /*
          * Current CW LTT cycle lasers with 5mins ON & 1min OFF. Legacy tests did
          * 5mins ON & 5mins OFF Therefore any data where laser power < some threshold
@@ -1754,19 +1516,20 @@ namespace burn_in_data_report
          */
 
         try {
+            kept_rows.clear();
             if ( !trim_data ) {
                 return true;
             }
 
-            const auto& config = settings.get_config();
-            const auto& filter_key = config.at("trim_filter_key").get<std::string>();
+            const file_schema& schema { settings.get_schema() };
+            const auto& filter_key = schema.trim_key;
             const auto& type_map = settings.get_col_types();
             if ( !type_map.contains(filter_key) || filter_key == "Combined Time" ) {
                 write_log(std::format(" | Invalid or no trim key provided ({}). | ", filter_key));
                 return true;
             }
             const auto& interval = settings.get_measurement_period();
-            if ( config.at("interval").at("method").get<std::string>() == "automatic" ) {
+            if ( schema.interval_method == time_method::automatic ) {
                 using second = std::chrono::duration<double, std::ratio<1>>;
                 using minute = std::chrono::duration<double, std::ratio<60>>;
                 write_log(std::format("\t\tinterval: {}", std::chrono::duration_cast<second>(interval)));
@@ -1827,15 +1590,16 @@ namespace burn_in_data_report
                 };
 
             indices_t trim_ranges;
+            const column_id filter_id { column_ids::find(filter_key) };
             // get sections of assumed invalid data
             switch ( data_type ) {
             case DataType::INTEGER: {
-                trim_ranges = measure_downtime(ints.at(filter_key),
+                trim_ranges = measure_downtime(cols.get<integer>(filter_id),
                                                static_cast<integer>( 0.5 * statistics.max_ints.at(filter_key) ));
                 break;
             }
             case DataType::DOUBLE: {
-                trim_ranges = measure_downtime(doubles.at(filter_key),
+                trim_ranges = measure_downtime(cols.get<double>(filter_id),
                                                0.5 * statistics.max_doubles.at(filter_key));
                 break;
             }
@@ -1846,86 +1610,26 @@ namespace burn_in_data_report
 
             // Remove sections of invalid data from all columns & update length data
             if ( trim_ranges.empty() ) { return true; }
+            kept_rows = trim_ranges;
 
-            const auto remove_data =
-                [&trim_ranges]<typename T>( TMap<T>& map, const std::string& key ) -> auto {
-                    std::vector<T> tmp;
-                    tmp.reserve(map.at(key).size());
-                    for ( const auto& [first, last] : trim_ranges ) {
-                        tmp.insert(tmp.cend(), map.at(key).begin() + first, map.at(key).begin() + last);
-                    }
-                    map[key] = std::move(tmp);
-                };
-
-            for ( const auto& [key, type] : type_map ) {
-                if ( key == "Combined Time" ) { continue; }
-                if ( type == DataType::INTEGER ) { remove_data(ints, key); }
-                else if ( type == DataType::DOUBLE ) { remove_data(doubles, key); }
-                else if ( type == DataType::STRING ) { remove_data(strings, key); }
-                else { throw std::runtime_error("DLL: <trim_data> Invalid type encountered."); }
-            }
+            // Columns not parsed yet (see load_options::columns) are trimmed with kept_rows when parsed
+            cols.for_each([&trim_ranges]( const column_id&, column_table::column& _col ) {
+                visit_rows([&trim_ranges]( auto& _rows ) { keep_rows(_rows, trim_ranges); }, _col.values);
+            });
 
             // All columns should be same length
-            // Update lengths in ints_len, doubles_len, strings_len
-            uinteger len{ 0 };
-            switch ( data_type ) {
-            case DataType::INTEGER:
-                len = static_cast<uinteger>(ints.at(filter_key).size());
-                break;
-            case DataType::DOUBLE:
-                len = static_cast<uinteger>(doubles.at(filter_key).size());
-                break;
-            case DataType::STRING:
-                len = static_cast<uinteger>(strings.at(filter_key).size());
-                break;
-            case DataType::NONE:
-                break;
-            }
-
-            for ( const auto& [key, type] : type_map ) {
-                if ( key == "Combined Time" ) { continue; }
-                switch ( type ) {
-                case DataType::INTEGER: {
-                        if ( ints.at(key).size() != len ) {
-                            throw
-                                std::runtime_error(
-                                    std::format("DLL: <trim_data> Failed to update altered data size ({}, {}).",
-                                                        key, type_string.at(type)
-                                    )
-                                );
-                        }
-                    }
-                    break;
-                case DataType::DOUBLE: {
-                        if ( doubles.at(key).size() != len ) {
-                            throw
-                                std::runtime_error(
-                                    std::format("DLL: <trim_data> Failed to update altered data size ({}, {}).",
-                                                        key, type_string.at(type)
-                                    )
-                                );
-                        }
-                    }
-                    break;
-                case DataType::STRING: {
-                        if ( strings.at(key).size() != len ) {
-                            throw
-                                std::runtime_error(
-                                    std::format("DLL: <trim_data> Failed to update altered data size ({}, {}).",
-                                                        key, type_string.at(type)
-                                    )
-                                );
-                        }
-                    }
-                    break;
-                case DataType::NONE:
-                    break;
+            const uinteger len { cols.rows(filter_id) };
+            for ( const auto& id : cols.ids() ) {
+                if ( cols.rows(id) != len ) {
+                    throw
+                        std::runtime_error(
+                            std::format("DLL: <trim_data> Failed to update altered data size ({}, {}).",
+                                        column_ids::title(id), type_string.at(cols.type(id))
+                            )
+                        );
                 }
             }
 
-            ints_len = len;
-            doubles_len = len;
-            strings_len = len;
             settings.set_n_rows(len);
 
 
@@ -1937,40 +1641,503 @@ namespace burn_in_data_report
         }
     }
 
+    // Loading options which change the parsed result of a file
+    inline uint64_t
+    file_data::cache_options_hash() const noexcept {
+        return fnv1a(std::format("{}|{}|{}", header_max_sz_, do_trimming_, max_off_time_.count()));
+    }
+
+    static void
+    write_stats( binary_writer& _out, const file_stats& _stats ) {
+        const auto write_map =
+            [&_out]<typename T>( const std::map<std::string, T>& _map ) {
+                _out.write(static_cast<uinteger>(_map.size()));
+                for ( const auto& [key, val] : _map ) {
+                    _out.write(std::string_view { key });
+                    _out.write(val);
+                }
+            };
+
+        write_map(_stats.max_ints);
+        write_map(_stats.min_ints);
+        write_map(_stats.max_doubles);
+        write_map(_stats.min_doubles);
+        write_map(_stats.parse_failures);
+
+        _out.write(static_cast<uinteger>(_stats._n.size()));
+        for ( const auto& [key, n] : _stats._n ) {
+            _out.write(std::string_view { key });
+            _out.write(n);
+        }
+    }
+
+    static void
+    read_stats( binary_reader& _in, file_stats& _stats ) {
+        const auto read_map =
+            [&_in]<typename T>( std::map<std::string, T>& _map ) {
+                _map.clear();
+                const auto n { _in.read<uinteger>() };
+                for ( uinteger i { 0 }; i < n; ++i ) {
+                    std::string key { _in.read_string() };
+                    _map[std::move(key)] = _in.read<T>();
+                }
+            };
+
+        read_map(_stats.max_ints);
+        read_map(_stats.min_ints);
+        read_map(_stats.max_doubles);
+        read_map(_stats.min_doubles);
+        read_map(_stats.parse_failures);
+
+        _stats._n.clear();
+        const auto n_cols { _in.read<uinteger>() };
+        for ( uinteger i { 0 }; i < n_cols; ++i ) {
+            std::string key { _in.read_string() };
+            _in.read(_stats._n[std::move(key)]);
+        }
+    }
+
+    // Writes the columns of _cols holding T: row count, column count, then each title & its values
+    template <typename T>
+    static void
+    write_cached_cols( binary_writer& _out, const column_table& _cols ) {
+        uinteger len { 0 }, n { 0 };
+        _cols.for_each([&len, &n]( const column_id&, const column_table::column& _col ) {
+            if ( const auto* values { std::get_if<column_table::storage<T>>(&_col.values) } ) {
+                len = static_cast<uinteger>(values->size());
+                ++n;
+            }
+        });
+
+        _out.write(len);
+        _out.write(n);
+        _cols.for_each([&_out]( const column_id& _id, const column_table::column& _col ) {
+            if ( const auto* values { std::get_if<column_table::storage<T>>(&_col.values) } ) {
+                _out.write(std::string_view { column_ids::title(_id) });
+                _out.write(*values);
+            }
+        });
+    }
+
+    /*
+    * Layout after the parse_cache_key header:
+    * config name, config hash, settings, columns (ints, doubles, strings)
+    * with their lengths, then the file_stats.
+    */
+    inline bool
+    file_data::store_cached( const uinteger& _idx ) const noexcept {
+        try {
+            const auto& settings { settings_[_idx] };
+            const auto key { parse_cache_key::of(files_[_idx].path(), cache_options_hash()) };
+
+            std::error_code ec;
+            std::filesystem::create_directories(options_.cache_dir, ec);
+
+            binary_writer out { parse_cache_file(options_.cache_dir, key) };
+            if ( !out.is_open() ) {
+                throw std::runtime_error(std::format("Failed to open cache file for {}.", key.path));
+            }
+
+            key.write(out);
+
+            const file_schema& schema { settings.get_schema() };
+            out.write(std::string_view { schema.name });
+            out.write(schema.hash);
+
+            out.write(static_cast<integer>(settings.get_start_time().time_since_epoch().count()));
+            out.write(static_cast<integer>(settings.get_last_write().time_since_epoch().count()));
+            out.write(static_cast<integer>(settings.get_measurement_period().count()));
+            out.write(settings.get_header_lim());
+            out.write(settings.get_data_pos());
+            out.write(settings.get_n_cols());
+            out.write(settings.get_n_rows());
+
+            const auto& col_order { settings.get_col_order() };
+            out.write(static_cast<uinteger>(col_order.size()));
+            for ( const auto& [title, idx] : col_order ) {
+                out.write(std::string_view { title });
+                out.write(idx);
+                out.write(static_cast<uint32_t>(settings.get_type(title)));
+            }
+
+            write_cached_cols<integer>(out, file_cols_[_idx]);
+            write_cached_cols<double>(out, file_cols_[_idx]);
+            write_cached_cols<std::string>(out, file_cols_[_idx]);
+
+            write_stats(out, statistics_[_idx]);
+
+            return out.commit();
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <file_data::store_cached>");
+            return false;
+        }
+    }
+
+    /*
+    * Opens the cache entry of files_[_idx] (memory mapped, read in place) &
+    * reads its header into _settings, leaving _in at the columns. Returns
+    * false if there is no entry or it's stale.
+    */
+    inline bool
+    file_data::open_cached( const uinteger& _idx, const schema_map& _schemas,
+                            mapped_file& _map, binary_reader& _in, file_settings& _settings ) const {
+        const auto key { parse_cache_key::of(files_[_idx].path(), cache_options_hash()) };
+        const auto cache_file { parse_cache_file(options_.cache_dir, key) };
+        if ( !std::filesystem::exists(cache_file) ) { return false; }
+
+        if ( !_map.open(cache_file) ) { return false; }
+        _in = binary_reader { _map.view() };
+
+        if ( parse_cache_key::read(_in) != key ) { return false; }
+
+        const std::string config_name { _in.read_string() };
+        const auto schema_iter { _schemas.find(config_name) };
+        if ( schema_iter == _schemas.end() || _in.read<uint64_t>() != schema_iter->second->hash ) {
+            return false;
+        }
+
+        _settings.set_schema(schema_iter->second);
+        _settings.set_start_time(std::chrono::sys_time<nano> { nano { _in.read<integer>() } });
+        _settings.set_last_write(std::chrono::sys_time<nano> { nano { _in.read<integer>() } });
+        _settings.set_measurement_period(nano { _in.read<integer>() });
+        _settings.set_header_lim(_in.read<uinteger>());
+        _settings.set_data_pos(_in.read<uinteger>());
+        _settings.set_n_cols(_in.read<uinteger>());
+        _settings.set_n_rows(_in.read<uinteger>());
+
+        const auto n_cols { _in.read<uinteger>() };
+        for ( uinteger i { 0 }; i < n_cols; ++i ) {
+            const std::string title { _in.read_string() };
+            _settings.col_order()[title] = _in.read<uinteger>();
+            _settings.col_types()[title] = static_cast<DataType>(_in.read<uint32_t>());
+        }
+        return true;
+    }
+
+    // Reads the cached columns of one type accepted by _want into _cols, skipping over the rest
+    template <typename T, typename Want>
+    static void
+    read_cached_cols( binary_reader& _in, column_table& _cols, const Want& _want ) {
+        _in.read<uinteger>(); // Row count, the file's settings hold it
+        const auto n { _in.read<uinteger>() };
+        for ( uinteger i { 0 }; i < n; ++i ) {
+            const std::string_view title { _in.read_string() };
+            if ( _want(title) ) { _in.read(_cols.add<T>(column_ids::intern(title))); }
+            else if constexpr ( std::is_same_v<T, std::string> ) { _in.skip<string_column>(); }
+            else { _in.skip<T>(); }
+        }
+    }
+
+    /*
+    * Fills settings_, file_cols_ & statistics_ of
+    * files_[_idx] from its cache entry, if one exists & is still valid.
+    * Columns outside load_options::columns are left in the cache until
+    * requested.
+    */
+    inline bool
+    file_data::load_cached( const uinteger& _idx, const schema_map& _schemas ) noexcept {
+        try {
+            mapped_file map;
+            binary_reader in { std::string_view {} };
+            file_settings settings { "", header_max_sz_ };
+            if ( !open_cached(_idx, _schemas, map, in, settings) ) { return false; }
+
+            const file_schema& schema { settings.get_schema() };
+            const auto wanted =
+                [this, &schema]( const std::string_view _title ) {
+                    const std::string title { _title };
+                    return options_.parses(title) || schema.required.contains(title);
+                };
+
+            column_table cols;
+            read_cached_cols<integer>(in, cols, wanted);
+            read_cached_cols<double>(in, cols, wanted);
+            read_cached_cols<std::string>(in, cols, wanted);
+
+            file_stats stats;
+            read_stats(in, stats);
+
+            // Only commit once the whole entry was read successfully
+            settings_[_idx] = std::move(settings);
+            file_cols_[_idx] = std::move(cols);
+            statistics_[_idx] = std::move(stats);
+            // Cached columns are already trimmed
+            kept_rows_[_idx].clear();
+
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            // Stale / corrupt entries fall back to parsing the file
+            write_err_log(err, std::format("DLL: <file_data::load_cached> {}", files_[_idx].path().string()));
+            return false;
+        }
+    }
+
+    // Reads column _key of files_[_idx] from its cache entry
+    inline bool
+    file_data::load_cached_column( const uinteger& _idx, const std::string& _key ) noexcept {
+        try {
+            const auto& schema { settings_[_idx].get_schema_ptr() };
+            if ( !schema ) { return false; }
+            const schema_map schemas { { schema->name, schema } };
+
+            mapped_file map;
+            binary_reader in { std::string_view {} };
+            file_settings settings { "", header_max_sz_ };
+            if ( !open_cached(_idx, schemas, map, in, settings) ) { return false; }
+
+            const auto wanted { [&_key]( const std::string_view _title ) { return _title == _key; } };
+            column_table cols;
+            read_cached_cols<integer>(in, cols, wanted);
+            read_cached_cols<double>(in, cols, wanted);
+            read_cached_cols<std::string>(in, cols, wanted);
+
+            const column_id id { column_ids::find(_key) };
+            if ( !cols.contains(id) ) { return false; }
+            file_cols_[_idx].add(id, cols.type(id)) = std::move(cols.at(id));
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, std::format("DLL: <file_data::load_cached_column> {} ({})",
+                                           files_[_idx].path().string(), _key));
+            return false;
+        }
+    }
+
+    // Whether column _key of files_[_idx] has been parsed
+    inline bool
+    file_data::has_column( const uinteger& _idx, const std::string& _key ) const noexcept {
+        return file_cols_[_idx].contains(_key);
+    }
+
+    // Whether every column of files_[_idx] has been parsed
+    inline bool
+    file_data::is_complete( const uinteger& _idx ) const noexcept {
+        for ( const auto& column : settings_[_idx].get_schema().columns ) {
+            if ( column.title != "Combined Time" && !file_cols_[_idx].contains(column.id) ) { return false; }
+        }
+        return true;
+    }
+
+    /*
+    * Runs the whole loading pipeline for files_[_idx]:
+    * probe -> detect config -> header/time/column scans ->
+    * read -> encode adjust -> split lines -> parse -> trim.
+    * Only the elements at _idx are touched, so each file runs as its own
+    * task on pool_. The raw text & lines are released as soon as the file
+    * is parsed. On failure _err describes the failed stage.
+    */
     inline bool
-    file_data::async_trim_data() noexcept {
-        if ( !do_trimming_ ) { return true; }
+    file_data::process_file( const uinteger& _idx, const schema_map& _schemas,
+                             const config_detector& _detector, std::string& _err ) noexcept {
+        const auto fail =
+            [&]( const std::string& _stage, const std::string& _msg ) -> bool {
+                _err = std::format("{}: {}", files_[_idx].path().string(), _msg);
+                write_log(std::format("<{}> failed in {}", _stage, files_[_idx].path().string()));
+                release_file(_idx);
+                return false;
+            };
 
         try {
+            auto& settings { settings_[_idx] };
+            auto& lines { file_lines_[_idx] };
+
+            // Unchanged since it was last parsed, skip the text pipeline entirely
+            if ( !options_.cache_dir.empty() && load_cached(_idx, _schemas) ) { return true; }
+
+            // Probe the start of the file: config, header & time stamps are found before
+            // the body is read, so files no config matches are never loaded in full.
+            std::string probe;
+            if ( !probe_file(files_[_idx], settings.get_headermaxlim() + 1, probe) ) {
+                return fail("probe_file", "Failed to read file header.");
+            }
+            std::string_view probe_text { probe };
+            if ( const auto encoding { find_encoding_type(probe_text) }; encoding != encoding_type::UNKNOWN ) {
+                probe_text.remove_prefix(encoding_bom.at(encoding).size());
+            }
+            line_index probe_lines;
+            if ( !text_to_lines(probe_text, probe_lines) ) {
+                return fail("text_to_lines", "Failed to convert text to lines.");
+            }
+
+            // Scan for file style, e.g Starlabs .txt or normal .csv style.
+            std::shared_ptr<const file_schema> schema;
+            if ( !verify_configs(_detector, probe_lines, settings.get_headermaxlim(), schema) ) {
+                return fail("parse_file_type", "Failed to parse file type.");
+            }
+            settings.set_schema(schema);
+
+            // Set header limit to start of data
+            if ( uinteger header_lim { settings.get_headermaxlim() };
+                line_check(probe_lines, *schema->header_identifier, header_lim) ) {
+                settings.set_header_lim(header_lim + 1);
+            }
+            else {
+                settings.set_header_lim(0);
+                return fail("header_halt_scan", "Failed to parse header info.");
+            }
+
+            if ( !time_stamp_scan(files_[_idx], probe_lines, settings) ) {
+                return fail("time_stamp_scan", "Failed to parse time stamps.");
+            }
+
+            if ( !column_title_scan(probe_lines, settings) ) {
+                return fail("column_title_scan", "Failed to parse column titles.");
+            }
+
+            // Passed, read the body
+            if ( options_.ingest == ingest_mode::mapped ) {
+                if ( !map_file(files_[_idx], maps_[_idx]) ) { return fail("map_file", "Failed to map file."); }
+                texts_[_idx] = maps_[_idx]->view();
+            }
+            else {
+                handles_[_idx] = get_file(files_[_idx]);
+                if ( !handles_[_idx]._data ) { return fail("get_file", "Failed to load file."); }
+                // get_file null terminates the final byte, exclude it from the text.
+                texts_[_idx] = std::string_view { handles_[_idx]._data,
+                                                  static_cast<std::size_t>(handles_[_idx]._sz - 1) };
+            }
+
+            // Scan & account for encoding
+            if ( !encode_adjust_file(encodings_[_idx], texts_[_idx]) ) {
+                return fail("encode_adjust_file", "Failed to adjust file encoding.");
+            }
+
+            // The probe's lines are the same complete lines, header_lim holds for the body
+            if ( !text_to_lines(texts_[_idx], lines) ) {
+                return fail("text_to_lines", "Failed to convert text to lines.");
+            }
+
+            if ( !parse_data(lines, settings, file_cols_[_idx], statistics_[_idx], options_, pool_.get()) ) {
+                return fail("parse_data", "Failed to parse data.");
+            }
+
+            // Parsed values are owned by file_cols_, drop the raw text,
+            // unless columns were left to be parsed on request (load_options::columns).
+            const bool complete { is_complete(_idx) };
+            if ( complete ) { release_file(_idx); }
+
+            kept_rows_[_idx].clear();
+            if ( do_trimming_
+                 && !trim_data(settings, do_trimming_, statistics_[_idx], file_cols_[_idx],
+                               max_off_time_, kept_rows_[_idx]) ) {
+                return fail("trim_data", "Failed to trim data.");
+            }
+
+            // Failing to write the cache only costs a re-parse next time. Partly parsed
+            // files are cached once their remaining columns are requested.
+            if ( complete && !options_.cache_dir.empty() ) { store_cached(_idx); }
+
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <file_data::process_file>");
+            return fail("process_file", "Failed to process file.");
+        }
+    }
+
+    // Frees the raw buffer / mapping & line views of files_[_idx]
+    inline void
+    file_data::release_file( const uinteger& _idx ) noexcept {
+        file_lines_[_idx].clear();
+        texts_[_idx] = std::string_view {};
+        handles_[_idx].free();
+        maps_[_idx].reset();
+    }
+
+    // Frees the parsed columns of files_[_idx], once combined. Its settings & stats are kept.
+    inline void
+    file_data::release_columns( const uinteger& _idx ) noexcept {
+        file_cols_[_idx] = column_table {};
+        released_[_idx] = true;
+    }
+
+    // Whether holding _extra more bytes would pass load_options::memory_budget
+    inline bool
+    file_data::over_budget( const uinteger& _extra ) const noexcept {
+        return options_.memory_budget != 0 && memory_usage() + _extra > options_.memory_budget;
+    }
+
+    inline uinteger
+    file_data::memory_usage() const noexcept {
+        uinteger bytes { data_.memory_usage() + static_cast<uinteger>(internal_time_.capacity() * sizeof(nano)) };
+        for ( const auto& handle : handles_ ) { bytes += handle._sz; }
+        for ( const auto& map : maps_ ) { if ( map ) { bytes += map->size(); } }
+        for ( const auto& lines : file_lines_ ) { bytes += lines.memory_usage(); }
+        for ( const auto& cols : file_cols_ ) { bytes += cols.memory_usage(); }
+        return bytes;
+    }
+
+    /*
+    * Pipelines every file not yet parsed through process_file independently,
+    * a slow file doesn't hold back the others. Files parsed by an earlier
+    * load keep their cached results. Failed files are recorded in
+    * failed_loads_ & success_.
+    */
+    inline bool
+    file_data::parse_pending() noexcept {
+        try {
+            schema_map schemas {};
+            if ( !collect_configs(config_loc_, schemas) ) {
+                write_err_log(std::runtime_error("DLL: <file_data::parse_pending> \"collect_configs\" failed"));
+                return false;
+            }
+            // Kept across loads until the config set changes
+            const auto detector { shared_config_detector(schemas) };
+
             std::vector<std::future<bool>> futures(files_.size());
+            std::vector<std::string> errors(files_.size());
+
+            for ( uinteger i { 0 }; i < files_.size(); ++i ) {
+                if ( success_[i] && !parsed_[i] ) {
+                    futures[i] = pool_->submit(&file_data::process_file, this, i,
+                                               std::cref(schemas), std::cref(*detector), std::ref(errors[i]));
+                }
+            }
+
+            // success_, parsed_ & released_ are std::vector<bool>, only written from this thread.
+            for ( uinteger i { 0 }; i < files_.size(); ++i ) {
+                if ( success_[i] && !parsed_[i] ) {
+                    if ( pool_->wait(futures[i]) ) {
+                        parsed_[i] = true;
+                        released_[i] = false;
+                    }
+                    else {
+                        failed_loads_.push_back(errors[i]);
+                        success_[i] = false;
+                    }
+                }
+            }
+            note_memory();
+
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <file_data::parse_pending>");
+            return false;
+        }
+    }
+
+    // Parses any new files, then combines them. Only combining waits on all files.
+    inline bool
+    file_data::async_process_files() noexcept {
+        try {
+            Timer t;
 
-            for ( uinteger i { 0 }; i < files_.size(); ++i ) {
-                if ( success_[i] ) {
-                    futures[i] =
-                        std::async(trim_data, std::ref(settings_[i]), do_trimming_,
-                                   std::ref(statistics_[i]), std::ref(file_ints_[i]),
-                                   std::ref(ints_lens_[i]), std::ref(file_doubles_[i]),
-                                   std::ref(doubles_lens_[i]), std::ref(file_strings_[i]),
-                                   std::ref(strings_lens_[i]), max_off_time_);
-                }
-            }
-            for ( uinteger i { 0 }; i < files_.size(); ++i ) {
-                if ( success_[i] ) {
-                    if ( !futures[i].get() ) {
-                        failed_loads_.push_back(std::format("{}: Failed to trim data.", files_[i].path().string()));
-                        write_log(std::format("<trim_data> failed in {}", files_[i].path().string()));
-                        success_[i] = false;
-                    }
-                }
-            }
+            if ( !parse_pending() ) { return false; }
+            write_log(std::format("   - Files parsed in {} seconds.", t.elapsed()));
 
-            if ( !check_valid_state(success_) )
-                return false;
+            if ( !check_valid_state(success_) ) { return false; }
+
+            t.reset();
+            if ( !async_combine_data() ) { return false; }
+            write_log(std::format("   - Data combined in {} seconds.", t.elapsed()));
 
             return true;
         }
         catch ( const std::exception& err ) {
-            write_err_log(err, "DLL: <file_data::async_trim_data>");
+            write_err_log(err, "DLL: <file_data::async_process_files>");
             return false;
         }
     }
@@ -1988,17 +2155,21 @@ namespace burn_in_data_report
             std::swap(encodings_[_a], encodings_[_b]);
             std::swap(file_lines_[_a], file_lines_[_b]);
             std::swap(handles_[_a], handles_[_b]);
+            std::swap(maps_[_a], maps_[_b]);
+            std::swap(texts_[_a], texts_[_b]);
             std::swap(settings_[_a], settings_[_b]);
-            std::swap(file_ints_[_a], file_ints_[_b]);
-            std::swap(ints_lens_[_a], ints_lens_[_b]);
-            std::swap(file_doubles_[_a], file_doubles_[_b]);
-            std::swap(doubles_lens_[_a], doubles_lens_[_b]);
-            std::swap(file_strings_[_a], file_strings_[_b]);
-            std::swap(strings_lens_[_a], strings_lens_[_b]);
+            std::swap(file_cols_[_a], file_cols_[_b]);
             const bool tmp = success_[_b];
             success_[_b] = success_[_a];
             success_[_a] = tmp;
+            const bool tmp_parsed = parsed_[_b];
+            parsed_[_b] = parsed_[_a];
+            parsed_[_a] = tmp_parsed;
+            const bool tmp_released = released_[_b];
+            released_[_b] = released_[_a];
+            released_[_a] = tmp_released;
             std::swap(statistics_[_a], statistics_[_b]);
+            std::swap(kept_rows_[_a], kept_rows_[_b]);
         }
         catch ( const std::exception& err ) {
             write_err_log(err, "DLL: <file_data::swap>");
@@ -2015,15 +2186,15 @@ namespace burn_in_data_report
             encodings_.erase(encodings_.begin() + _pos);
             file_lines_.erase(file_lines_.begin() + _pos);
             handles_.erase(handles_.begin() + _pos);
+            maps_.erase(maps_.begin() + _pos);
+            texts_.erase(texts_.begin() + _pos);
             settings_.erase(settings_.begin() + _pos);
-            file_ints_.erase(file_ints_.begin() + _pos);
-            ints_lens_.erase(ints_lens_.begin() + _pos);
-            file_doubles_.erase(file_doubles_.begin() + _pos);
-            doubles_lens_.erase(doubles_lens_.begin() + _pos);
-            file_strings_.erase(file_strings_.begin() + _pos);
-            strings_lens_.erase(strings_lens_.begin() + _pos);
+            file_cols_.erase(file_cols_.begin() + _pos);
             success_.erase(success_.begin() + _pos);
+            parsed_.erase(parsed_.begin() + _pos);
             statistics_.erase(statistics_.begin() + _pos);
+            kept_rows_.erase(kept_rows_.begin() + _pos);
+            released_.erase(released_.begin() + _pos);
 
             return true;
         }
@@ -2041,19 +2212,15 @@ namespace burn_in_data_report
             encodings_.erase(encodings_.begin() + _start, encodings_.begin() + _end);
             file_lines_.erase(file_lines_.begin() + _start, file_lines_.begin() + _end);
             handles_.erase(handles_.begin() + _start, handles_.begin() + _end);
+            maps_.erase(maps_.begin() + _start, maps_.begin() + _end);
+            texts_.erase(texts_.begin() + _start, texts_.begin() + _end);
             settings_.erase(settings_.begin() + _start, settings_.begin() + _end);
-            file_ints_.erase(file_ints_.begin() + _start, file_ints_.begin() + _end);
-            ints_lens_.erase(ints_lens_.begin() + _start, ints_lens_.begin() + _end);
-            file_doubles_.erase(file_doubles_.begin() + _start,
-                                file_doubles_.begin() + _end);
-            doubles_lens_.erase(doubles_lens_.begin() + _start,
-                                doubles_lens_.begin() + _end);
-            file_strings_.erase(file_strings_.begin() + _start,
-                                file_strings_.begin() + _end);
-            strings_lens_.erase(strings_lens_.begin() + _start,
-                                strings_lens_.begin() + _end);
+            file_cols_.erase(file_cols_.begin() + _start, file_cols_.begin() + _end);
             success_.erase(success_.begin() + _start, success_.begin() + _end);
+            parsed_.erase(parsed_.begin() + _start, parsed_.begin() + _end);
             statistics_.erase(statistics_.begin() + _start, statistics_.begin() + _end);
+            kept_rows_.erase(kept_rows_.begin() + _start, kept_rows_.begin() + _end);
+            released_.erase(released_.begin() + _start, released_.begin() + _end);
         }
         catch ( const std::exception& err ) {
             write_err_log(err, "DLL<file_data::erase>");
@@ -2208,6 +2375,7 @@ namespace burn_in_data_report
                 _dest.min_doubles[key] = std::numeric_limits<double>::max();
                 _dest.min_ints[key] = std::numeric_limits<integer>::max();
                 _dest._n[key] = {};
+                _dest.parse_failures[key] = 0;
             }
 
             for ( const auto& [key, type] : _type_map ) {
@@ -2230,6 +2398,9 @@ namespace burn_in_data_report
 
                         _dest._n[key].insert(_dest._n[key].end(), stats._n.at(key).begin(),
                                          stats._n.at(key).end());
+                        if ( const auto iter { stats.parse_failures.find(key) }; iter != stats.parse_failures.end() ) {
+                            _dest.parse_failures[key] += iter->second;
+                        }
                     }
                     catch ( const std::exception& err ) { write_err_log(err, "DLL: <combine_stats>"); }
                 }
@@ -2247,51 +2418,101 @@ namespace burn_in_data_report
         return true;
     }
 
+    /*
+    * Merges the per-file results into the combined columns.
+    * The first file_boundaries_.size() files are already merged, in sorted
+    * order. If every newly parsed file starts after them only the new rows
+    * are appended, otherwise the combined data is rebuilt from the cached
+    * per-file results. Files are never re-parsed here.
+    */
     inline bool
     file_data::async_combine_data() noexcept {
         try {
-            // Empty any previously combined data
-            ints_.clear();
-            doubles_.clear();
-            strings_.clear();
-            internal_time_.clear();
-            file_boundaries_.clear();
+            generation_ = next_generation();
 
             // Remove all files which failed to load:
             if ( !clear_failed_loads() ) {
                 write_err_log(std::runtime_error("DLL: <file_data::async_combine_data> \"clear_failed_loads\" failed."));
                 return false;
             }
-            // Presort all entries here:
-            if ( !sort_files() ) {
-                write_err_log(std::runtime_error("DLL: <file_data::async_combine_data> \"sort_files\" failed."));
+
+            // Columns a config always parses stay combined under a projection
+            if ( options_.lazy || !options_.columns.empty() ) {
+                for ( const auto& settings : settings_ ) {
+                    options_.columns.insert(settings.get_schema().required.begin(), settings.get_schema().required.end());
+                }
+            }
+
+            const auto n_files { static_cast<uinteger>(files_.size()) };
+            uinteger n_merged { static_cast<uinteger>(file_boundaries_.size()) };
+            if ( n_merged > n_files ) { n_merged = 0; }
+
+            // Presort new entries, then check they can simply be appended
+            if ( n_merged > 0 && n_merged < n_files
+                 && !file_data_qsrt(*this, n_merged, n_files - 1, 0) ) {
+                write_err_log(std::runtime_error("DLL: <file_data::async_combine_data> \"file_data_qsrt\" failed."));
                 return false;
             }
+            const bool append {
+                n_merged > 0
+                && (n_merged == n_files
+                    || settings_[n_merged].get_start_time() >= settings_[n_merged - 1].get_start_time())
+            };
+
+            if ( !append ) {
+                // Re-merging needs the columns freed after an earlier combine, re-parse those files
+                if ( std::ranges::find(released_, true) != released_.end() ) {
+                    for ( uinteger i { 0 }; i < n_files; ++i ) {
+                        if ( released_[i] ) { parsed_[i] = false; }
+                    }
+                    if ( !parse_pending() || std::ranges::find(success_, false) != success_.end() ) {
+                        write_err_log(std::runtime_error("DLL: <file_data::async_combine_data> Failed to re-parse released files."));
+                        return false;
+                    }
+                }
+
+                // Empty any previously combined data
+                data_.clear();
+                internal_time_.clear();
+                file_boundaries_.clear();
+                col_types().clear();
+
+                // Presort all entries here:
+                if ( !sort_files() ) {
+                    write_err_log(std::runtime_error("DLL: <file_data::async_combine_data> \"sort_files\" failed."));
+                    return false;
+                }
+            }
+
+            const uinteger first { append ? n_merged : 0 };
+            const auto n_prev_rows { static_cast<uinteger>(internal_time_.size()) };
+
             // get all unique (ColTitle + ColType) pairs
             if ( !combine_cols(settings_, this->col_types()) ) {
                 write_err_log(std::runtime_error("DLL: <file_data::async_combine_data> \"combine_cols\" failed."));
                 return false;
             }
 
-            // Add empty entries to ints_, doubles_, strings_
+            // Columns combined here, by id: titles are only looked up once per column.
+            // Deferred columns are combined by load_deferred when requested.
+            std::vector<std::tuple<column_id, const std::string*, DataType>> combined;
             for ( const auto& [key, type] : this->col_types() ) {
-                switch ( type ) {
-                case DataType::INTEGER:
-                    ints_[key] = {};
-                    break;
-                case DataType::DOUBLE:
-                    doubles_[key] = {};
-                    break;
-                default: {
-                    if ( type == DataType::STRING || type == DataType::NONE ) { strings_[key] = {}; }
-                    else {
-                        write_err_log(std::runtime_error("DLL: <file_data::async_combine_data> NONE type data encountered"));
-                    }
-                }
+                if ( key == "Combined Time" || is_deferred(key) ) { continue; }
+                combined.emplace_back(column_ids::intern(key), &key, type);
+            }
+
+            // Add entries for new columns to data_, padding any rows already merged (0 / 0. / "").
+            for ( const auto& [id, key, type] : combined ) {
+                if ( !data_.contains(id) ) {
+                    std::visit([n_prev_rows]( auto& _values ) { _values.resize(n_prev_rows); },
+                               data_.add(id, type).values);
                 }
             }
 
-            if ( !combine_stats(this->get_col_types(), statistics_, *this) ) {
+            TypeMap data_cols { this->get_col_types() };
+            data_cols.erase("Combined Time");
+            std::erase_if(data_cols, [this]( const auto& _col ) { return is_deferred(_col.first); });
+            if ( !combine_stats(data_cols, statistics_, *this) ) {
                 write_err_log(std::runtime_error("DLL: <file_data::async_combine_data> \"combine_stats\" failed."));
                 return false;
             }
@@ -2305,27 +2526,34 @@ namespace burn_in_data_report
             * Count total number of rows so memory can be
             * pre-reserved, avoiding reallocations.
             */
-            uinteger n_rows =
-                std::accumulate(settings_.cbegin(), settings_.cend(),
-                                static_cast<uinteger>( 0 ),
+            const uinteger n_rows =
+                std::accumulate(settings_.cbegin() + first, settings_.cend(),
+                                n_prev_rows,
                                 []( uinteger lhs, const file_settings& rhs ) -> uinteger {
                                     return lhs += rhs.get_n_rows();
                                 });
 
             /*
             * Create internal time representation as if all
-            * the data is continuous.
+            * the data is continuous, continuing on from the
+            * last merged file.
             * Register boundaries between files
             */
+            auto current_time { nano::zero() };
+            if ( append ) {
+                const auto& last { settings_[first - 1] };
+                current_time = file_boundaries_.back().internal_time
+                               + last.get_measurement_period() * static_cast<integer>(last.get_n_rows());
+            }
             internal_time_.reserve(n_rows);
             internal_time_.resize(n_rows);
-            uinteger pos { 0 };
-            auto current_time { nano::zero() };
-            for ( const auto& [i, settings] : enumerate(settings_) ) {
+            uinteger pos { n_prev_rows };
+            for ( uinteger i { first }; i < n_files; ++i ) {
+                const auto& settings { settings_[i] };
                 /*
                 * Add record of file boundary
                 */
-                file_boundaries_.emplace_back(file_boundary_t(static_cast<uinteger>(i), files_[i].path().filename().string(), current_time, settings.get_start_time()));
+                file_boundaries_.emplace_back(file_boundary_t(static_cast<uinteger>(i), files_[i].path().filename().string(), current_time, settings.get_start_time(), pos, settings.get_n_rows()));
                 write_log(std::format("file boundary: {}, {}, {}, {}", i, files_[i].path().filename().string(), current_time.count(), settings.get_start_time()));
 
                 const nano& interval = settings.get_measurement_period();
@@ -2336,27 +2564,29 @@ namespace burn_in_data_report
             }
             auto& cols{ col_types() };
             cols["Combined Time"] = DataType::DOUBLE;
-            doubles_["Combined Time"] = get_internal_time_double();
+            {
+                using seconds = std::chrono::duration<double, std::chrono::seconds::period>;
+                auto& combined_time { data_.add<double>(column_ids::intern("Combined Time")) };
+                combined_time.reserve(n_rows);
+                for ( uinteger j { n_prev_rows }; j < n_rows; ++j ) {
+                    combined_time.emplace_back(std::chrono::duration_cast<seconds>(internal_time_[j]).count());
+                }
+            }
 
             /*
-            * Iterate through (col, type) pairs
-            * Lookup in each _file_(ints/doubles/strings)
+            * Iterate through the combined columns
+            * Lookup in each file's columns by id
             * If exists --> Concatenate
             * If not --> Concatenate array of 0/0.0/("NULL"/"")
             */
             const auto concat_vals =
-                [this]<typename T>(
-                const TMap<T>& _lookup_loc, TMap<T>& _storage_loc,
-                const std::string& key, const DataType& type,
-                const uinteger& _len, const file_stats& _stats,
-                const T& _default_fill = 0 ) {
-                    const auto iter = _lookup_loc.find(key);
-                    if ( iter != _lookup_loc.end() ) {
+                [this]<typename C>(
+                const column_table& _file, C& _storage_loc,
+                const column_id& _id, const std::string& key, const DataType& type,
+                const uinteger& _len, const file_stats& _stats ) {
+                    if ( const auto* values { _file.find<typename C::value_type>(_id) } ) {
                         // Insert separate data to end of combined storage
-                        _storage_loc[key].insert(
-                            _storage_loc[key].end(),
-                            _lookup_loc.at(key).begin(), _lookup_loc.at(key).end()
-                        );
+                        append_rows(_storage_loc, *values);
 
                         try {
                             // Update value of max / min in (max/min)_[typename]
@@ -2385,41 +2615,50 @@ namespace burn_in_data_report
                         return true;
                     }
                     // Key didn't exist insert _len default values as placeholder
-                    _storage_loc[key].insert(
-                                             _storage_loc[key].end(),
-                                             _len,
-                                             _default_fill
-                                            );
+                    _storage_loc.resize(_storage_loc.size() + _len);
                     return true;
                 };
+            /*
+            * Over the memory budget, each file's columns are freed as they're
+            * combined so the data isn't held twice. Only fully parsed files,
+            * the rest still parse deferred columns into file_cols_.
+            */
+            uinteger n_new_bytes { 0 };
+            for ( uinteger j { first }; j < n_files; ++j ) { n_new_bytes += file_cols_[j].memory_usage(); }
+            std::vector<bool> release(n_files, false);
+            if ( over_budget(n_new_bytes) ) {
+                for ( uinteger j { 0 }; j < n_files; ++j ) { release[j] = !released_[j] && is_complete(j); }
+            }
+
             /*
             * For all (title, type) pairs in ALL files.
             * It is NOT guaranteed that all files have the same title type pairs.
             * It IS guaranteed that all titles will be unique.
+            * Placeholders are sized from each file's row count so columns stay aligned.
             */
-            for ( const auto& [title, type] : this->col_types() ) {
-                // Skip 
-                if ( title == "Combined Time" ) { continue; }
-
-                for ( uinteger j = 0; j < files_.size(); ++j ) {
-                    switch ( type ) {
-                    case DataType::INTEGER:
-                        concat_vals(file_ints_[j], ints_, title, type, ints_lens_[j],
-                                   statistics_[j], static_cast<integer>(0));
-                        break;
-                    case DataType::DOUBLE:
-                        concat_vals(file_doubles_[j], doubles_, title, type, doubles_lens_[j],
-                                   statistics_[j], 0.);
-                        break;
-                    case DataType::STRING:
-                        concat_vals(file_strings_[j], strings_, title, type, strings_lens_[j],
-                                   statistics_[j], std::string(""));
-                        break;
-                    case DataType::NONE:
-                        write_err_log(std::runtime_error("DLL: <file_data::async_combine_data> Invalid type received."));
-                        return false;
-                    }
+            for ( const auto& [id, title, type] : combined ) {
+                if ( type == DataType::NONE ) {
+                    write_err_log(std::runtime_error("DLL: <file_data::async_combine_data> Invalid type received."));
+                    return false;
+                }
+
+                auto& values { data_.at(id).values };
+                for ( uinteger j { first }; j < n_files; ++j ) {
+                    const uinteger len { settings_[j].get_n_rows() };
+                    std::visit([&, id, title]( auto& _values ) {
+                        concat_vals(file_cols_[j], _values, id, *title, type, len, statistics_[j]);
+                    }, values);
+                    if ( release[j] ) { file_cols_[j].erase(id); }
                 }
+                note_memory();
+            }
+
+            for ( uinteger j { 0 }; j < n_files; ++j ) {
+                if ( release[j] ) { release_columns(j); }
+            }
+            if ( std::ranges::find(release, true) != release.end() ) {
+                write_log(std::format("Memory budget: per-file columns released, {} bytes held (peak {}).",
+                                      memory_usage(), peak_memory_));
             }
 
             set_n_cols(static_cast<uinteger>(col_types().size()));
@@ -2430,4 +2669,534 @@ namespace burn_in_data_report
             return false;
         }
     }
+
+    inline bool
+    file_data::remove_file( const uinteger& file_idx ) noexcept {
+        try { return remove_files({ file_idx }); }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <file_data::remove_file>");
+            return false;
+        }
+    }
+
+    /*
+    * Removes files without re-reading the remaining ones. Each removed
+    * file's row range (from file_boundaries_) is cut out of the combined
+    * columns & internal_time_ in a single pass, later files are shifted
+    * back in internal time by the removed durations & the combined stats
+    * are recomputed from the cached per-file stats.
+    */
+    inline bool
+    file_data::remove_files( const std::vector<uinteger>& indexes ) noexcept {
+        try {
+            if ( read_only_ ) { throw std::runtime_error("Data opened from a column store or database is read only."); }
+            generation_ = next_generation();
+            std::vector<uinteger> sorted_list { indexes };
+
+            // Sort indexes, smallest at front, dropping duplicates
+            std::ranges::sort(sorted_list);
+            sorted_list.erase(std::unique(sorted_list.begin(), sorted_list.end()), sorted_list.end());
+
+            if ( sorted_list.empty() ) { return true; }
+            if ( sorted_list.back() >= files_.size() ) {
+                throw std::out_of_range(std::format("File index out of range: {}", sorted_list.back()));
+            }
+
+            // Nothing merged to splice (or out of step), erase the cached results & re-merge the rest
+            if ( file_boundaries_.size() != files_.size() ) {
+                for ( const auto& idx : sorted_list | std::views::reverse )
+                    if ( !erase(idx) ) { return false; }
+
+                file_boundaries_.clear();
+                return recalculate_files();
+            }
+
+            // Row ranges being removed, in order
+            indices_t cut_rows;
+            cut_rows.reserve(sorted_list.size());
+            for ( const auto& idx : sorted_list ) {
+                const auto& boundary { file_boundaries_[idx] };
+                cut_rows.emplace_back(boundary.row_offset, boundary.row_offset + boundary.n_rows);
+            }
+
+            // Moves every row outside of cut_rows down over the removed ones
+            const auto splice =
+                [&cut_rows]<typename T>( std::vector<T>& _col ) {
+                    auto write { _col.begin() };
+                    uinteger read_pos { 0 };
+                    for ( const auto& [start, end] : cut_rows ) {
+                        write = std::move(_col.begin() + read_pos, _col.begin() + start, write);
+                        read_pos = end;
+                    }
+                    write = std::move(_col.begin() + read_pos, _col.end(), write);
+                    _col.erase(write, _col.end());
+                };
+
+            data_.for_each([&splice]( const column_id&, column_table::column& _col ) {
+                visit_rows(splice, _col.values);
+            });
+
+            // Shift later files back by the rows & internal time removed before them
+            std::vector<file_boundary_t> boundaries;
+            boundaries.reserve(file_boundaries_.size() - sorted_list.size());
+            uinteger n_cut_rows { 0 };
+            nano cut_time { nano::zero() };
+            uinteger first_shifted { static_cast<uinteger>(internal_time_.size()) };
+            auto next_cut { sorted_list.cbegin() };
+            for ( uinteger i { 0 }; i < file_boundaries_.size(); ++i ) {
+                // Internal time spanned by file i, up to the next file's start
+                const nano span {
+                    i + 1 < file_boundaries_.size()
+                        ? file_boundaries_[i + 1].internal_time - file_boundaries_[i].internal_time
+                        : settings_[i].get_measurement_period() * static_cast<integer>(file_boundaries_[i].n_rows)
+                };
+
+                if ( next_cut != sorted_list.cend() && *next_cut == i ) {
+                    n_cut_rows += file_boundaries_[i].n_rows;
+                    cut_time += span;
+                    ++next_cut;
+                    continue;
+                }
+
+                auto boundary { file_boundaries_[i] };
+                if ( n_cut_rows > 0 || cut_time != nano::zero() ) {
+                    first_shifted = MIN(first_shifted, boundary.row_offset - n_cut_rows);
+                }
+                boundary.index = static_cast<integer>(boundaries.size());
+                boundary.row_offset -= n_cut_rows;
+                boundary.internal_time -= cut_time;
+                boundaries.emplace_back(std::move(boundary));
+            }
+
+            splice(internal_time_);
+
+            file_boundaries_ = std::move(boundaries);
+
+            // Drop the cached per-file results of the removed files
+            for ( const auto& idx : sorted_list | std::views::reverse )
+                if ( !erase(idx) ) { return false; }
+
+            // Rebuild the internal time of the shifted rows from their boundaries
+            for ( const auto& boundary : file_boundaries_ ) {
+                if ( boundary.row_offset + boundary.n_rows <= first_shifted ) { continue; }
+                const nano& interval { settings_[boundary.index].get_measurement_period() };
+                auto current_time { boundary.internal_time };
+                for ( uinteger j { boundary.row_offset }; j < boundary.row_offset + boundary.n_rows; ++j ) {
+                    internal_time_[j] = current_time;
+                    current_time += interval;
+                }
+            }
+
+            {
+                using seconds = std::chrono::duration<double, std::chrono::seconds::period>;
+                auto& combined_time { data_.add<double>(column_ids::intern("Combined Time")) };
+                combined_time.resize(internal_time_.size());
+                for ( uinteger j { first_shifted }; j < internal_time_.size(); ++j ) {
+                    combined_time[j] = std::chrono::duration_cast<seconds>(internal_time_[j]).count();
+                }
+            }
+
+            // Columns only provided by removed files are dropped
+            TypeMap remaining_cols {};
+            if ( !combine_cols(settings_, remaining_cols) ) {
+                write_err_log(std::runtime_error("DLL: <file_data::remove_files> \"combine_cols\" failed."));
+                return false;
+            }
+            for ( const auto& [key, type] : this->get_col_types() ) {
+                if ( key == "Combined Time" || remaining_cols.contains(key) ) { continue; }
+                data_.erase(column_ids::find(key));
+                col_types().erase(key);
+            }
+
+            max_ints.clear();
+            min_ints.clear();
+            max_doubles.clear();
+            min_doubles.clear();
+            _n.clear();
+            parse_failures.clear();
+            std::erase_if(remaining_cols, [this]( const auto& _col ) { return is_deferred(_col.first); });
+            if ( !combine_stats(remaining_cols, statistics_, *this) ) {
+                write_err_log(std::runtime_error("DLL: <file_data::remove_files> \"combine_stats\" failed."));
+                return false;
+            }
+
+            if ( files_.empty() ) {
+                data_.clear();
+                internal_time_.clear();
+                col_types().clear();
+            }
+
+            set_n_cols(static_cast<uinteger>(col_types().size()));
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <file_data::remove_files>");
+            return false;
+        }
+    }
+
+    /*
+    * Writes the combined columns, internal time & file boundaries to a column
+    * store. "Combined Time" is derived from the internal time when the store
+    * is opened, so it isn't written.
+    */
+    inline bool
+    file_data::save_store( const std::filesystem::path& _path ) noexcept {
+        try {
+            const Timer t;
+
+            /*
+            * Saving over the opened store: Windows won't replace a file while
+            * it's mapped, so every column is read out of it & it's closed
+            * before the new store is committed in its place.
+            */
+            if ( std::error_code ec; store_ && std::filesystem::equivalent(_path, store_->path(), ec) ) {
+                if ( store_.use_count() > 1 ) {
+                    throw std::runtime_error(std::format(
+                        "Cannot save over {}, another copy of the data still has it open.", _path.string()));
+                }
+                for ( const auto& [key, type] : get_col_types() ) {
+                    if ( key != "Combined Time" && !page_in(key) ) {
+                        throw std::runtime_error(std::format("Failed to read {} from {}.", key, _path.string()));
+                    }
+                }
+                store_.reset();
+            }
+
+            column_store_writer out { _path, static_cast<uinteger>(internal_time_.size()) };
+            if ( !out.is_open() ) {
+                throw std::runtime_error(std::format("Failed to open {} for writing.", _path.string()));
+            }
+
+            // Columns of an opened store which were never requested are copied from it
+            const auto add =
+                [this, &out]<typename C>( const std::string& _key, const C* _loaded ) {
+                if ( _loaded ) { out.add_column(_key, *_loaded); }
+                else if ( store_ && store_->contains(_key) ) {
+                    C values;
+                    store_->read(_key, values);
+                    out.add_column(_key, values);
+                }
+                else { throw std::out_of_range(std::format("Column {} has no data.", _key)); }
+            };
+
+            out.set_internal_time(internal_time_);
+            out.set_file_boundaries(file_boundaries_);
+            for ( const auto& [key, type] : get_col_types() ) {
+                if ( key == "Combined Time" ) { continue; }
+                if ( is_deferred(key) && !page_in(key) ) {
+                    throw std::runtime_error(std::format("Failed to parse deferred column {}.", key));
+                }
+                const column_id id { column_ids::find(key) };
+                switch ( type ) {
+                case DataType::INTEGER: add(key, data_.find<integer>(id)); break;
+                case DataType::DOUBLE: add(key, data_.find<double>(id)); break;
+                case DataType::STRING: add(key, data_.find<std::string>(id)); break;
+                case DataType::NONE: break;
+                }
+            }
+
+            if ( !out.commit() ) { return false; }
+            write_log(std::format("Saved column store {}, {}s.", _path.string(), t.elapsed()));
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <file_data::save_store>");
+            return false;
+        }
+    }
+
+    /*
+    * Replaces the loaded data with a column store. Only the directory,
+    * internal time & file boundaries are read, stats come from the per chunk
+    * min / max. Column values are read by page_in on first request.
+    */
+    inline bool
+    file_data::open_store( const std::filesystem::path& _path ) noexcept {
+        try {
+            const Timer t;
+            auto store { std::make_shared<column_store>() };
+            if ( !store->open(_path) ) {
+                throw std::runtime_error(std::format("Failed to open column store {}.", _path.string()));
+            }
+
+            reset_data();
+            internal_time_ = store->internal_time();
+            file_boundaries_ = store->file_boundaries();
+
+            const auto cols { store->col_types() };
+            for ( const auto& [key, type] : cols ) {
+                integer max_int = std::numeric_limits<integer>::lowest(), min_int = std::numeric_limits<integer>::max();
+                double max_double = std::numeric_limits<double>::lowest(), min_double = std::numeric_limits<double>::max();
+                if ( type != DataType::STRING ) {
+                    for ( const auto& chunk : store->chunks(key) ) {
+                        max_int = MAX(max_int, chunk.max_i);
+                        min_int = MIN(min_int, chunk.min_i);
+                        if ( !std::isnan(chunk.max_d) ) { max_double = MAX(max_double, chunk.max_d); }
+                        if ( !std::isnan(chunk.min_d) ) { min_double = MIN(min_double, chunk.min_d); }
+                    }
+                }
+                max_ints[key] = max_int;
+                min_ints[key] = min_int;
+                max_doubles[key] = max_double;
+                min_doubles[key] = min_double;
+            }
+
+            finish_external(cols);
+            store_ = std::move(store);
+
+            write_log(std::format("Opened column store {} ({} rows, {} columns), {}s.",
+                                  _path.string(), get_n_rows(), get_n_cols(), t.elapsed()));
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <file_data::open_store>");
+            return false;
+        }
+    }
+
+    /*
+    * Reads _key from the column store, or parses it if it was left out of
+    * loading (load_options::columns / lazy), unless that's been done already.
+    * No-op otherwise.
+    */
+    inline bool
+    file_data::page_in( const std::string& _key ) noexcept {
+        try {
+            if ( is_deferred(_key) ) { return load_deferred(_key); }
+            if ( !store_ || !store_->contains(_key) ) { return true; }
+
+            const column_id id { column_ids::intern(_key) };
+            if ( data_.contains(id) ) { return true; }
+            generation_ = next_generation(); // Adding a column may move the others
+            switch ( get_type(_key) ) {
+            case DataType::INTEGER: store_->read(_key, data_.add<integer>(id)); break;
+            case DataType::DOUBLE: store_->read(_key, data_.add<double>(id)); break;
+            case DataType::STRING: store_->read(_key, data_.add<std::string>(id)); break;
+            case DataType::NONE: return false;
+            }
+            note_memory();
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            data_.erase(column_ids::find(_key));
+            write_err_log(err, std::format("DLL: <file_data::page_in> (key = {})", _key));
+            return false;
+        }
+    }
+
+    /*
+    * Parses deferred column _key of files_[_idx]: from the file's retained
+    * line index, or its cache entry if it was loaded from the cache. Rows
+    * are trimmed as the rest of the file was. Only the elements at _idx are
+    * touched, so files run as separate tasks. Throws on failure.
+    */
+    inline void
+    file_data::load_deferred_file( const uinteger& _idx, const std::string& _key ) {
+        const auto& settings { settings_[_idx] };
+        if ( !settings.get_col_types().contains(_key) || has_column(_idx, _key) ) { return; }
+
+        const auto& lines { file_lines_[_idx] };
+        if ( !lines.empty() ) {
+            const DataType type { settings.get_type(_key) };
+            const auto& column { settings.get_schema().columns.at(settings.get_col_order().at(_key)) };
+            auto& values { file_cols_[_idx].add(column.id, type).values };
+            column_parser parser {
+                &_key, column.idx, type, std::get_if<std::vector<integer>>(&values),
+                std::get_if<std::vector<double>>(&values), std::get_if<string_column>(&values), 0
+            };
+            if ( column.datetime ) { parser.datetime = &*column.datetime; }
+
+            std::vector<column_parser> parsers { parser };
+            parse_rows(lines, settings.get_schema().delim, parsers, settings.get_header_lim(), lines.size());
+            statistics_[_idx].parse_failures[_key] = parsers.front().failures;
+            // Stats are taken before trimming, as parse_data does
+            set_column_stats(_key, column.id, file_cols_[_idx], statistics_[_idx]);
+
+            // Trimmed as the rest of the file was
+            if ( const auto& kept { kept_rows_[_idx] }; !kept.empty() ) {
+                visit_rows([&kept]( auto& _rows ) { keep_rows(_rows, kept); }, values);
+            }
+        }
+        // The cache entry's stats were read with the file
+        else if ( options_.cache_dir.empty() || !load_cached_column(_idx, _key) ) {
+            throw std::runtime_error(std::format("No retained text or cache entry for {} of {}.",
+                                                 _key, files_[_idx].path().string()));
+        }
+
+        // Fully parsed, the text is no longer needed
+        if ( is_complete(_idx) ) {
+            if ( !lines.empty() && !options_.cache_dir.empty() ) { store_cached(_idx); }
+            release_file(_idx);
+        }
+    }
+
+    /*
+    * Parses column _key, left out of loading (load_options::columns / lazy),
+    * in every file that has it, one task per file on pool_. The column & its
+    * stats are then combined as async_combine_data does.
+    */
+    inline bool
+    file_data::load_deferred( const std::string& _key ) noexcept {
+        try {
+            const Timer t;
+
+            if ( !pool_ ) { pool_ = shared_thread_pool(options_.n_threads); }
+            std::vector<std::future<void>> futures;
+            futures.reserve(files_.size());
+            for ( uinteger i { 0 }; i < files_.size(); ++i ) {
+                futures.push_back(pool_->submit(&file_data::load_deferred_file, this, i, std::cref(_key)));
+            }
+
+            // Wait on every task before reporting a failure, they reference this frame
+            std::exception_ptr failure;
+            for ( auto& future : futures ) {
+                try { pool_->wait(future); }
+                catch ( ... ) { if ( !failure ) { failure = std::current_exception(); } }
+            }
+            if ( failure ) { std::rethrow_exception(failure); }
+
+            // From now on _key is parsed & combined like any other column
+            options_.columns.insert(_key);
+
+            const DataType type { get_type(_key) };
+            const column_id id { column_ids::intern(_key) };
+            generation_ = next_generation();
+            const auto combine =
+                [this, &id]<typename C>( C& _col ) {
+                    _col.clear();
+                    _col.reserve(static_cast<uinteger>(internal_time_.size()));
+                    for ( const auto& boundary : file_boundaries_ ) {
+                        const auto& file { file_cols_[static_cast<uinteger>(boundary.index)] };
+                        if ( const auto* values { file.find<typename C::value_type>(id) } ) { append_rows(_col, *values); }
+                        else { _col.resize(static_cast<uinteger>(_col.size()) + boundary.n_rows); }
+                    }
+                };
+            std::visit(combine, data_.add(id, type).values);
+            if ( data_.rows(id) != internal_time_.size() ) {
+                data_.erase(id);
+                throw std::runtime_error(std::format("Combined length mismatch for {}.", _key));
+            }
+
+            if ( !combine_stats(TypeMap { { _key, type } }, statistics_, *this) ) {
+                throw std::runtime_error(std::format("Failed to combine stats for {}.", _key));
+            }
+
+            // Files now fully parsed are combined in full, free their columns if over budget
+            note_memory();
+            if ( over_budget() ) {
+                for ( uinteger i { 0 }; i < files_.size(); ++i ) {
+                    if ( !released_[i] && is_complete(i) ) { release_columns(i); }
+                }
+            }
+
+            write_log(std::format("Parsed deferred column {}, {}s.", _key, t.elapsed()));
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, std::format("DLL: <file_data::load_deferred> (key = {})", _key));
+            return false;
+        }
+    }
+
+    // Drops all files & data, keeping the loading settings
+    inline void
+    file_data::reset_data() noexcept {
+        file_data reset {};
+        reset.config_loc_ = config_loc_;
+        reset.header_max_sz_ = header_max_sz_;
+        reset.max_off_time_ = max_off_time_;
+        reset.do_trimming_ = do_trimming_;
+        reset.options_ = options_;
+        *this = std::move(reset);
+    }
+
+    /*
+    * Completes data which wasn't parsed from files (column store, assign):
+    * sets the column types, per boundary counts & "Combined Time" from
+    * internal_time_ / file_boundaries_. The data becomes read only.
+    */
+    inline void
+    file_data::finish_external( const TypeMap& _cols ) noexcept {
+        auto& cols { col_types() };
+        cols = _cols;
+        for ( const auto& [key, type] : _cols ) {
+            auto& n { _n[key] };
+            n.clear();
+            for ( const auto& boundary : file_boundaries_ ) { n.push_back(static_cast<integer>(boundary.n_rows)); }
+            if ( file_boundaries_.empty() ) { n.push_back(static_cast<integer>(internal_time_.size())); }
+        }
+
+        cols["Combined Time"] = DataType::DOUBLE;
+        {
+            using seconds = std::chrono::duration<double, std::chrono::seconds::period>;
+            auto& combined_time { data_.add<double>(column_ids::intern("Combined Time")) };
+            combined_time.clear();
+            combined_time.reserve(internal_time_.size());
+            for ( const auto& time : internal_time_ ) {
+                combined_time.emplace_back(std::chrono::duration_cast<seconds>(time).count());
+            }
+        }
+
+        set_n_cols(static_cast<uinteger>(cols.size()));
+        set_n_rows(static_cast<uinteger>(internal_time_.size()));
+        read_only_ = true;
+        note_memory();
+    }
+
+    /*
+    * Replaces the loaded data with complete columns, every column must have
+    * _internal_time.size() rows. Stats are computed here.
+    */
+    inline bool
+    file_data::assign( const TypeMap& _cols, column_table&& _data, std::vector<nano>&& _internal_time,
+                       std::vector<file_boundary_t>&& _boundaries ) noexcept {
+        try {
+            const auto n_rows { _internal_time.size() };
+            for ( const auto& [key, type] : _cols ) {
+                const column_id id { column_ids::find(key) };
+                if ( type == DataType::NONE ) { throw std::runtime_error(std::format("Column {} has no type.", key)); }
+                if ( _data.type(id) != type ) {
+                    throw std::runtime_error(std::format("Column {} is missing or of the wrong type.", key));
+                }
+                if ( const auto len { _data.rows(id) }; len != n_rows ) {
+                    throw std::runtime_error(std::format("Column {} has {} rows, expected {}.", key, len, n_rows));
+                }
+            }
+
+            reset_data();
+            data_ = std::move(_data);
+            internal_time_ = std::move(_internal_time);
+            file_boundaries_ = std::move(_boundaries);
+
+            for ( const auto& [key, type] : _cols ) {
+                integer max_int = std::numeric_limits<integer>::lowest(), min_int = std::numeric_limits<integer>::max();
+                double max_double = std::numeric_limits<double>::lowest(), min_double = std::numeric_limits<double>::max();
+                if ( type == DataType::INTEGER ) {
+                    for ( const auto& val : data_.get<integer>(column_ids::find(key)) ) {
+                        max_int = MAX(max_int, val);
+                        min_int = MIN(min_int, val);
+                    }
+                }
+                else if ( type == DataType::DOUBLE ) {
+                    for ( const auto& val : data_.get<double>(column_ids::find(key)) ) {
+                        if ( std::isnan(val) ) { continue; }
+                        max_double = MAX(max_double, val);
+                        min_double = MIN(min_double, val);
+                    }
+                }
+                max_ints[key] = max_int;
+                min_ints[key] = min_int;
+                max_doubles[key] = max_double;
+                min_doubles[key] = min_double;
+            }
+
+            finish_external(_cols);
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <file_data::assign>");
+            return false;
+        }
+    }
 } // namespace burn_in_data_report
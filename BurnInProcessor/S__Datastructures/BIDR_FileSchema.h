@@ -0,0 +1,202 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <regex>
+#include <set>
+#include <string_view>
+
+#include "../BIDR_Defines.h"
+#include "../F__File_Parse/BIDR_Regex.h"
+#include "../F__File_Parse/BIDR_TimeParse.h"
+#include "../F__Storage_IO/BIDR_ParseCache.h"
+#include "BIDR_ColumnTable.h"
+
+namespace burn_in_data_report
+{
+    /*
+    * Membership table for a config's delimiter characters, lets the row
+    * tokenizer test each char with one lookup rather than a loop over delims.
+    */
+    class delimiter_table
+    {
+    private:
+        std::array<bool, 256> table_ {};
+
+    public:
+        constexpr delimiter_table() noexcept = default;
+
+        constexpr explicit delimiter_table( const std::string_view _delims ) noexcept {
+            for ( const char& d : _delims ) { table_[static_cast<unsigned char>(d)] = true; }
+        }
+
+        [[nodiscard]] constexpr bool
+        operator()( const char _c ) const noexcept { return table_[static_cast<unsigned char>(_c)]; }
+    };
+
+    // How a config finds the test start time ("start_time") or measurement interval ("interval")
+    enum class time_method
+    {
+        none = 0,
+        in_header = 1,    // Regex capture on a header line
+        in_file_path = 2, // Regex search of the file path, start time only
+        in_data = 3,      // Column of the first data row, start time only
+        value = 4,        // Fixed increment in seconds, interval only
+        automatic = 5     // Detected from a data column while parsing, interval only
+    };
+
+    /*
+    * A config compiled once into the form the loading stages read: the
+    * delimiter table, column positions, ids & types, compiled regexes, time
+    * methods & trim key. Compiled schemas are immutable & shared by every
+    * file matching the config, file_settings only holds a pointer to it.
+    * Regexes point into the process-wide cached_regex cache.
+    */
+    struct file_schema
+    {
+        // A configured column, at field position idx of a data row
+        struct column
+        {
+            std::string                title;
+            column_id                  id;          // Interned title
+            uinteger                   idx;
+            DataType                   type;
+            std::optional<time_parser> datetime {}; // "datetime_columns" entry, parsed to ns since epoch
+        };
+
+        std::string    name {};
+        nlohmann::json config {};     // The source config, as read
+        uint64_t       hash { 0 };    // config_hash(config)
+
+        std::string     delim_chars {};
+        delimiter_table delim {};
+        const std::regex* file_identifier { nullptr };
+        const std::regex* header_identifier { nullptr };
+        std::string       identifier_prefix {};      // Literal start of any file_identifier match
+
+        std::vector<column>             columns {};   // In field order
+        TypeMap                         col_types {};
+        std::map<std::string, uinteger> col_order {};
+
+        time_method start_method { time_method::none };
+        const std::regex* start_pattern { nullptr };
+        time_parser start_time_parser {};
+        uinteger    start_col_index { 0 };
+
+        time_method interval_method { time_method::none };
+        const std::regex* interval_pattern { nullptr };
+        time_parser interval_time_parser {};
+        nano        interval_increment { nano::zero() };
+        std::string interval_title {};               // Column the interval is detected from (automatic)
+
+        std::string           trim_key {};           // "trim_filter_key", empty if there isn't one
+        std::set<std::string> required {};           // Parsed whatever the load projection: trim key &
+                                                     // automatic interval title
+
+        // Throws if _config is missing a key or holds an invalid value
+        static std::shared_ptr<const file_schema>
+        compile( const nlohmann::json& _config );
+    };
+
+    // Compiled schemas keyed by config name
+    using schema_map = std::unordered_map<std::string, std::shared_ptr<const file_schema>>;
+
+
+    inline std::shared_ptr<const file_schema>
+    file_schema::compile( const nlohmann::json& _config ) {
+        auto schema { std::make_shared<file_schema>() };
+
+        schema->name = _config.at("name").get<std::string>();
+        schema->config = _config;
+        schema->hash = config_hash(_config);
+
+        schema->delim_chars = _config.at("delim").get<std::string>();
+        schema->delim = delimiter_table { schema->delim_chars };
+        const auto identifier { _config.at("file_identifier").get<std::string>() };
+        schema->file_identifier = &cached_regex(identifier);
+        schema->identifier_prefix = regex_literal_prefix(identifier);
+        schema->header_identifier = &cached_regex(_config.at("header_identifier").get<std::string>());
+
+        const auto titles { _config.at("titles").get<std::vector<std::string>>() };
+        const auto types { _config.at("types").get<std::vector<DataType>>() };
+        if ( titles.size() != types.size() ) {
+            throw std::runtime_error("Length mismatch between \"titles\" and \"types\" parameters in configuration file.");
+        }
+        for ( uinteger i { 0 }; i < titles.size(); ++i ) {
+            schema->columns.push_back({ titles[i], column_ids::intern(titles[i]), i, types[i] });
+            schema->col_types[titles[i]] = types[i];
+            schema->col_order[titles[i]] = i;
+        }
+
+        // { title: time_pattern }, values are stored as INTEGER ns since epoch
+        if ( _config.contains("datetime_columns") ) {
+            for ( const auto& [title, pattern] : _config.at("datetime_columns").items() ) {
+                if ( !schema->col_order.contains(title) ) {
+                    throw std::runtime_error(std::format("Unknown datetime column \"{}\".", title));
+                }
+                time_parser parser { pattern.get<std::string>() };
+                if ( !parser.supported() || !parser.has_date() ) {
+                    throw std::runtime_error(
+                        std::format("Unsupported time_pattern \"{}\" for datetime column \"{}\".", parser.pattern(), title));
+                }
+
+                auto& column { schema->columns[schema->col_order.at(title)] };
+                column.type = DataType::INTEGER;
+                column.datetime = std::move(parser);
+                schema->col_types[title] = DataType::INTEGER;
+            }
+        }
+
+        const auto& start { _config.at("start_time") };
+        const auto& start_params { start.at("params") };
+        if ( const std::string method { start.at("method").get<std::string>() }; method == "in_header" ) {
+            schema->start_method = time_method::in_header;
+            schema->start_pattern = &cached_regex(start_params.at("re_pattern").get<std::string>());
+        }
+        else if ( method == "in_file_path" ) {
+            schema->start_method = time_method::in_file_path;
+            schema->start_pattern = &cached_regex(start_params.at("re_pattern").get<std::string>());
+        }
+        else if ( method == "in_data" ) {
+            schema->start_method = time_method::in_data;
+            schema->start_col_index = start_params.at("col_index").get<uinteger>();
+        }
+        else { throw std::runtime_error("<file_schema::compile> Unknown test start time scanning method."); }
+        schema->start_time_parser = time_parser { start_params.at("time_pattern").get<std::string>() };
+
+        const auto& interval { _config.at("interval") };
+        const auto& interval_params { interval.at("params") };
+        if ( const std::string method { interval.at("method").get<std::string>() }; method == "in_header" ) {
+            schema->interval_method = time_method::in_header;
+            schema->interval_pattern = &cached_regex(interval_params.at("re_pattern").get<std::string>());
+            schema->interval_time_parser = time_parser { interval_params.at("time_pattern").get<std::string>() };
+        }
+        else if ( method == "value" ) {
+            using seconds = std::chrono::duration<double, std::ratio<1>>;
+            schema->interval_method = time_method::value;
+            schema->interval_increment =
+                std::chrono::duration_cast<nano>(seconds { interval_params.at("increment").get<double>() });
+        }
+        else if ( method == "automatic" ) {
+            schema->interval_method = time_method::automatic;
+            schema->interval_title = interval_params.at("title").get<std::string>();
+            if ( !schema->col_types.contains(schema->interval_title) ) {
+                throw std::runtime_error("Invalid title parsed in configuration file to automatically detect measurement interval.");
+            }
+            schema->required.insert(schema->interval_title);
+        }
+        else {
+            throw std::runtime_error(
+                std::format("Invalid \"interval\" method: \"{}\" received. Check for mistakes in {} configuration.",
+                            method, schema->name));
+        }
+
+        if ( _config.contains("trim_filter_key") ) {
+            schema->trim_key = _config.at("trim_filter_key").get<std::string>();
+            schema->required.insert(schema->trim_key);
+        }
+
+        return schema;
+    }
+} // NAMESPACE: burn_in_data_report
@@ -1,16 +1,52 @@
 #pragma once
 
+#include <memory>
+#include <set>
+
 #include "../BIDR_Defines.h"
+#include "BIDR_FileSchema.h"
 
 namespace burn_in_data_report
 {
+    enum class ingest_mode
+    {
+        copy = 0,   // Read each file into an owned buffer
+        mapped = 1  // Map each file read-only, lines & values view the mapping directly
+    };
+
+    /*
+    * Options controlling how file_data loads its files, set once
+    * before loading (e.g from the spreadsheet "Settings" page).
+    */
+    struct load_options
+    {
+        ingest_mode ingest { ingest_mode::copy };
+        uinteger    n_threads { 0 };    // Worker threads for loading, 0 = hardware concurrency
+        std::filesystem::path
+        cache_dir {};                   // Parse cache location, empty = no caching
+        std::set<std::string>
+        columns {};                     // Columns parsed while loading, empty = all. The rest are
+                                        // parsed on first request (file_data::page_in).
+        bool        lazy { false };     // Parse no columns while loading (bar the trim key & interval
+                                        // title), each is parsed on first request.
+        uinteger    memory_budget { 0 }; // Bytes file_data aims to stay under, 0 = no limit. Past it,
+                                        // each file's columns are freed once combined.
+
+        // Whether _title is parsed while loading, besides a config's required columns
+        [[nodiscard]] bool
+        parses( const std::string& _title ) const noexcept {
+            return columns.contains(_title) || (!lazy && columns.empty());
+        }
+    };
+
+
     class file_settings
     {
     private:
         // Private vars
         std::string filename_;                      // Filename
-        FileFormat                                  // FileFormat --> std::pair<std::string, nlohmann::json>
-        format_;                                    // Config name + configuration in nlohmann::json format
+        std::shared_ptr<const file_schema>
+        schema_;                                    // Compiled config the file matched, shared by all its files
         std::chrono::sys_time<nano>
         last_write_;                                // Last write time rel. to epoch (nanoseconds)
         std::chrono::sys_time<nano>
@@ -30,7 +66,6 @@ namespace burn_in_data_report
         uinteger data_pos_;                         // Row data begins
         uinteger
         header_lim_;                                // Header Limit (end point exclusive). Data starts on this row.
-        nlohmann::json config_;                     // Config for the file in question
         uinteger
         header_max_lim_;                            // Maximum value for the header limit, by default=256
 
@@ -38,7 +73,7 @@ namespace burn_in_data_report
         // Public setters
         void set_filename( const std::string& filename ) noexcept { filename_ = filename; }
 
-        void set_format( const FileFormat& format ) noexcept { format_ = format; }
+        void set_schema( const std::shared_ptr<const file_schema>& schema ) noexcept { schema_ = schema; }
 
         void set_last_write( const std::chrono::sys_time<nano>& last_write ) noexcept { last_write_ = last_write; }
 
@@ -58,13 +93,11 @@ namespace burn_in_data_report
 
         void set_header_lim( const uinteger& header_lim ) { header_lim_ = header_lim; }
 
-        void set_config( const nlohmann::json& config ) noexcept { config_ = config; }
-
         void set_headermaxlim( const uinteger& header_max_lim ) noexcept { header_max_lim_ = header_max_lim; }
 
         file_settings( const std::string& filename, const uinteger& header_max_lim ) :
             filename_(filename),
-            format_(FileFormat("", "{}")),
+            schema_(nullptr),
             last_write_(std::chrono::sys_time<nano> {}),
             start_time_(std::chrono::sys_time<nano> {}),
             measurement_period_(nano::zero()),
@@ -74,7 +107,6 @@ namespace burn_in_data_report
             n_rows_(0),
             data_pos_(0),
             header_lim_(0),
-            config_(0),
             header_max_lim_(header_max_lim) {}
 
         ~file_settings() noexcept = default;                                       // destructor.
@@ -85,7 +117,14 @@ namespace burn_in_data_report
         file_settings&
         operator=( file_settings&& _other ) noexcept = default;        // move assign.
 
-        const FileFormat get_format() const noexcept { return format_; }
+        // The matched config, an empty schema until one is matched
+        const file_schema&
+        get_schema() const noexcept {
+            static const file_schema none {};
+            return schema_ ? *schema_ : none;
+        }
+
+        const std::shared_ptr<const file_schema>& get_schema_ptr() const noexcept { return schema_; }
 
         const std::string get_filename() const noexcept { return filename_; }
 
@@ -99,9 +138,9 @@ namespace burn_in_data_report
 
         const std::vector<std::string> get_col_titles() const noexcept { return get_keys(col_types_); }
 
-        const TypeMap get_col_types() const noexcept { return col_types_; }
+        const TypeMap& get_col_types() const noexcept { return col_types_; }
 
-        const std::map<std::string, uinteger> get_col_order() const noexcept { return col_order_; }
+        const std::map<std::string, uinteger>& get_col_order() const noexcept { return col_order_; }
 
         const uinteger get_n_cols() const noexcept { return n_cols_; }
 
@@ -109,15 +148,13 @@ namespace burn_in_data_report
 
         const uinteger get_header_lim() const noexcept { return header_lim_; }
 
-        const nlohmann::json get_config() const noexcept { return config_; }
+        const nlohmann::json& get_config() const noexcept { return get_schema().config; }
 
         const uinteger get_headermaxlim() const noexcept { return header_max_lim_; }
 
         const DataType
         get_type( const std::string& _key ) const noexcept;
 
-        FileFormat& get_format() noexcept { return format_; }
-
         std::string& get_filename() noexcept { return filename_; }
 
         std::chrono::sys_time<nano>& get_last_write() noexcept { return last_write_; }
@@ -138,8 +175,6 @@ namespace burn_in_data_report
 
         uinteger& get_header_lim() noexcept { return header_lim_; }
 
-        nlohmann::json& get_config() noexcept { return config_; }
-
         uinteger& get_headermaxlim() noexcept { return header_max_lim_; }
     };
 
@@ -6,6 +6,8 @@
 //#include <cmath>
 #include <iostream>
 #include <filesystem>
+#include <string_view>
+#include <utility>
 
 #include "../BIDR_Defines.h"
 
@@ -73,10 +75,9 @@ namespace burn_in_data_report
                 return *this;
             }
 
-            if ( _other._data ) {
-                _data = std::exchange(_other._data, nullptr);
-                _sz   = std::exchange(_other._sz, 0);
-            }
+            free(); // Release any buffer already held
+            _data = std::exchange(_other._data, nullptr);
+            _sz   = std::exchange(_other._sz, 0);
 
             return *this;
         }
@@ -183,7 +184,7 @@ namespace burn_in_data_report
 
         char* realloc( const uinteger& sz ) noexcept { return realloc(_data, _sz, sz); }
 
-        static void free( char* _target ) noexcept {
+        static void free( char*& _target ) noexcept {
             if ( _target ) {
                 delete[] _target;
                 _target = nullptr;
@@ -191,11 +192,129 @@ namespace burn_in_data_report
         }
 
         void free() noexcept {
-            free(_data); // if (_data) handled in free(char* _target)
-            if ( !_data )
-                _sz = 0;
+            free(_data); // if (_data) handled in free(char*& _target)
+            _sz = 0;
         }
 
         char at( uinteger _idx ) const noexcept { if ( _data && _idx < _sz ) { return _data[_idx]; } }
     };
+
+
+    /*
+    * Read-only memory mapping of a file. The view stays valid until
+    * close() is called or the object is destroyed, so string_views built
+    * over it (e.g. file_data lines) are only valid for its lifetime.
+    * Move-only, share through std::shared_ptr where copies are needed.
+    * The file is opened sharing read, write & delete, so logs still being
+    * written can be mapped & writers can keep appending while mapped.
+    * Only the size at open is mapped, bytes appended later aren't seen.
+    */
+    class mapped_file
+    {
+    private:
+        HANDLE      file_;
+        HANDLE      mapping_;
+        const char* view_;
+        uinteger    sz_;
+
+    public:
+        mapped_file() noexcept :
+            file_(INVALID_HANDLE_VALUE),
+            mapping_(nullptr),
+            view_(nullptr),
+            sz_(0) {}
+
+        explicit mapped_file( const std::filesystem::path& _path ) :
+            mapped_file() {
+            if ( !open(_path) ) {
+                throw std::runtime_error(
+                    std::format("DLL: <mapped_file> Failed to map {}.", _path.string())
+                );
+            }
+        }
+
+        ~mapped_file() { close(); }
+
+        mapped_file( const mapped_file& _other ) = delete;
+        mapped_file& operator=( const mapped_file& _other ) = delete;
+
+        mapped_file( mapped_file&& _other ) noexcept :
+            file_(std::exchange(_other.file_, INVALID_HANDLE_VALUE)),
+            mapping_(std::exchange(_other.mapping_, nullptr)),
+            view_(std::exchange(_other.view_, nullptr)),
+            sz_(std::exchange(_other.sz_, 0)) {}
+
+        mapped_file& operator=( mapped_file&& _other ) noexcept {
+            if ( this == &_other ) { return *this; }
+            close();
+            file_    = std::exchange(_other.file_, INVALID_HANDLE_VALUE);
+            mapping_ = std::exchange(_other.mapping_, nullptr);
+            view_    = std::exchange(_other.view_, nullptr);
+            sz_      = std::exchange(_other.sz_, 0);
+            return *this;
+        }
+
+        bool open( const std::filesystem::path& _path ) noexcept {
+            close();
+
+            file_ = CreateFileW(_path.wstring().c_str(),
+                                GENERIC_READ,
+                                FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                nullptr,
+                                OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                                nullptr);
+            if ( file_ == INVALID_HANDLE_VALUE ) { return false; }
+
+            LARGE_INTEGER file_sz;
+            if ( !GetFileSizeEx(file_, &file_sz) ) {
+                close();
+                return false;
+            }
+            sz_ = static_cast<uinteger>(file_sz.QuadPart);
+
+            // Zero length files can't be mapped, treat as an open but empty view.
+            if ( sz_ == 0 ) { return true; }
+
+            // Sized explicitly, a writer may have appended since GetFileSizeEx
+            mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY,
+                                          static_cast<DWORD>(file_sz.QuadPart >> 32),
+                                          static_cast<DWORD>(file_sz.QuadPart & 0xFFFFFFFF), nullptr);
+            if ( !mapping_ ) {
+                close();
+                return false;
+            }
+
+            view_ = static_cast<const char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0,
+                                                           static_cast<std::size_t>(sz_)));
+            if ( !view_ ) {
+                close();
+                return false;
+            }
+
+            return true;
+        }
+
+        void close() noexcept {
+            if ( view_ ) { UnmapViewOfFile(view_); }
+            if ( mapping_ ) { CloseHandle(mapping_); }
+            if ( file_ != INVALID_HANDLE_VALUE ) { CloseHandle(file_); }
+            file_    = INVALID_HANDLE_VALUE;
+            mapping_ = nullptr;
+            view_    = nullptr;
+            sz_      = 0;
+        }
+
+        [[nodiscard]] bool is_open() const noexcept { return file_ != INVALID_HANDLE_VALUE; }
+
+        [[nodiscard]] const char* data() const noexcept { return view_; }
+
+        [[nodiscard]] uinteger size() const noexcept { return sz_; }
+
+        [[nodiscard]] std::string_view view() const noexcept {
+            return view_
+                       ? std::string_view { view_, static_cast<std::size_t>(sz_) }
+                       : std::string_view {};
+        }
+    };
 } // NAMESPACE: burn_in_data_report
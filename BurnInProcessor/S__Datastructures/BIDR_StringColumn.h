@@ -0,0 +1,196 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../BIDR_Defines.h"
+
+namespace burn_in_data_report
+{
+    /*
+    * A dictionary encoded string column: each distinct value is held once in
+    * an arena of concatenated bytes (offsets_ holds each value's start, then
+    * the end, as the column store's dictionaries) & every row is a uint32
+    * code into it. Mostly repeated values (status flags, unit labels) cost 4
+    * bytes a row rather than a heap string each, & rows are trimmed, filtered
+    * or spliced by moving codes alone. Codes only mean something within their
+    * own column, append() maps another column's codes across.
+    */
+    class string_column
+    {
+    public:
+        using code_type = uint32_t;
+        using value_type = std::string;
+
+    private:
+        std::string                                     bytes_ {};
+        std::vector<uinteger>                           offsets_ { 0 };
+        std::unordered_multimap<std::size_t, code_type> index_ {}; // Value hash -> code
+        std::vector<code_type>                          codes_ {}; // One per row
+
+        [[nodiscard]] static std::size_t
+        hash( const std::string_view _value ) noexcept { return std::hash<std::string_view> {}(_value); }
+
+    public:
+        string_column() = default;
+
+        explicit string_column( const std::vector<std::string>& _values ) {
+            codes_.reserve(_values.size());
+            for ( const auto& value : _values ) { push_back(value); }
+        }
+
+        // Code of _value, added to the dictionary if it's new
+        code_type
+        intern( const std::string_view _value ) {
+            const auto h { hash(_value) };
+            for ( auto [iter, last] { index_.equal_range(h) }; iter != last; ++iter ) {
+                if ( value(iter->second) == _value ) { return iter->second; }
+            }
+
+            if ( n_values() >= std::numeric_limits<code_type>::max() ) {
+                throw std::length_error("<string_column::intern> Too many distinct values.");
+            }
+            const auto code { static_cast<code_type>(n_values()) };
+            bytes_.append(_value);
+            offsets_.push_back(static_cast<uinteger>(bytes_.size()));
+            index_.emplace(h, code);
+            return code;
+        }
+
+        // Distinct values held
+        [[nodiscard]] uinteger n_values() const noexcept { return static_cast<uinteger>(offsets_.size() - 1); }
+
+        [[nodiscard]] std::string_view
+        value( const code_type& _code ) const noexcept {
+            return std::string_view { bytes_ }.substr(offsets_[_code], offsets_[_code + 1] - offsets_[_code]);
+        }
+
+        [[nodiscard]] uinteger size() const noexcept { return static_cast<uinteger>(codes_.size()); }
+
+        [[nodiscard]] bool empty() const noexcept { return codes_.empty(); }
+
+        [[nodiscard]] std::string_view operator[]( const uinteger& _row ) const noexcept { return value(codes_[_row]); }
+
+        [[nodiscard]] std::string_view at( const uinteger& _row ) const { return value(codes_.at(_row)); }
+
+        [[nodiscard]] const std::vector<code_type>& codes() const noexcept { return codes_; }
+
+        // Row codes, rows may be reordered or removed through them but only take codes of this column
+        [[nodiscard]] std::vector<code_type>& codes() noexcept { return codes_; }
+
+        void push_back( const std::string_view _value ) { codes_.push_back(intern(_value)); }
+
+        void reserve( const uinteger& _n ) { codes_.reserve(_n); }
+
+        // New rows are empty strings
+        void
+        resize( const uinteger& _n ) {
+            if ( _n > codes_.size() ) { codes_.resize(_n, intern("")); }
+            else { codes_.resize(_n); }
+        }
+
+        void
+        clear() noexcept {
+            bytes_.clear();
+            offsets_.assign(1, 0);
+            index_.clear();
+            codes_.clear();
+        }
+
+        void
+        shrink_to_fit() {
+            bytes_.shrink_to_fit();
+            offsets_.shrink_to_fit();
+            codes_.shrink_to_fit();
+        }
+
+        // Appends the rows of _other, its distinct values are looked up once each
+        void
+        append( const string_column& _other ) {
+            std::vector<code_type> remap(_other.n_values());
+            for ( code_type code { 0 }; code < remap.size(); ++code ) { remap[code] = intern(_other.value(code)); }
+
+            codes_.reserve(codes_.size() + _other.codes_.size());
+            for ( const auto& code : _other.codes_ ) { codes_.push_back(remap[code]); }
+        }
+
+        void
+        append( string_column&& _other ) {
+            if ( codes_.empty() && n_values() == 0 ) { *this = std::move(_other); }
+            else { append(static_cast<const string_column&>(_other)); }
+        }
+
+        // The rows within _ranges, in order, sharing this column's dictionary
+        [[nodiscard]] string_column
+        select( const indices_t& _ranges ) const {
+            string_column result;
+            result.bytes_ = bytes_;
+            result.offsets_ = offsets_;
+            result.index_ = index_;
+            uinteger n { 0 };
+            for ( const auto& [first, last] : _ranges ) { n += last - first; }
+            result.codes_.reserve(n);
+            for ( const auto& [first, last] : _ranges ) {
+                result.codes_.insert(result.codes_.end(), codes_.begin() + first, codes_.begin() + last);
+            }
+            return result;
+        }
+
+        // Values of rows [_first, _last) joined by _delimiter
+        [[nodiscard]] std::string
+        join( const uinteger& _first, const uinteger& _last, const std::string_view _delimiter ) const {
+            std::string result;
+            for ( uinteger row { _first }; row < _last; ++row ) {
+                if ( row != _first ) { result.append(_delimiter); }
+                result.append((*this)[row]);
+            }
+            return result;
+        }
+
+        [[nodiscard]] std::vector<std::string>
+        to_strings() const {
+            std::vector<std::string> result;
+            result.reserve(codes_.size());
+            for ( const auto& code : codes_ ) { result.emplace_back(value(code)); }
+            return result;
+        }
+
+        [[nodiscard]] const std::string& bytes() const noexcept { return bytes_; }
+
+        // Bytes held, the dictionary index estimated from its node & bucket counts
+        [[nodiscard]] uinteger
+        memory_usage() const noexcept {
+            return static_cast<uinteger>(bytes_.capacity() + offsets_.capacity() * sizeof(uinteger)
+                                         + codes_.capacity() * sizeof(code_type)
+                                         + index_.size() * (sizeof(decltype(index_)::value_type) + sizeof(void*))
+                                         + index_.bucket_count() * sizeof(void*));
+        }
+
+        [[nodiscard]] const std::vector<uinteger>& offsets() const noexcept { return offsets_; }
+
+        // Rebuilds the column from its parts (e.g read back from a file), throws if they're inconsistent
+        void
+        assign( const std::string_view _bytes, std::vector<uinteger>&& _offsets, std::vector<code_type>&& _codes ) {
+            if ( _offsets.empty() || _offsets.front() != 0 || _offsets.back() != _bytes.size()
+                 || !std::ranges::is_sorted(_offsets) ) {
+                throw std::out_of_range("<string_column::assign> Corrupt dictionary.");
+            }
+            const auto n { static_cast<uinteger>(_offsets.size() - 1) };
+            if ( std::ranges::any_of(_codes, [n]( const code_type& _code ) { return _code >= n; }) ) {
+                throw std::out_of_range("<string_column::assign> Code out of range.");
+            }
+
+            bytes_.assign(_bytes);
+            offsets_ = std::move(_offsets);
+            codes_ = std::move(_codes);
+            index_.clear();
+            index_.reserve(n);
+            for ( code_type code { 0 }; code < n; ++code ) { index_.emplace(hash(value(code)), code); }
+        }
+    };
+} // NAMESPACE: burn_in_data_report
@@ -0,0 +1,372 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../BIDR_Defines.h"
+
+namespace burn_in_data_report
+{
+    /*
+    * Bounded work-stealing executor shared by the file loading stages.
+    * - Each worker owns a deque. Tasks submitted from a worker go to the
+    *   front of its own deque (LIFO, cache friendly), tasks submitted from
+    *   outside the pool are dealt round-robin to the back of the deques.
+    * - Idle workers take from the front of their own deque, then steal
+    *   from the back of the others.
+    * - Tasks that split into sub-tasks (e.g a file's parse chunks) use a
+    *   task_group, its wait() only helps with the group's own sub-tasks so
+    *   a worker never runs unrelated tasks on top of its own stack.
+    */
+    class thread_pool
+    {
+        friend class task_group;
+
+    private:
+        using task_t = std::function<void()>;
+
+        struct task_queue
+        {
+            std::mutex mtx;
+            std::deque<task_t> tasks;
+        };
+
+        std::vector<std::unique_ptr<task_queue>> queues_;
+        std::vector<std::thread> workers_;
+        std::mutex wake_mtx_;
+        std::condition_variable wake_;
+        std::atomic<uinteger> n_queued_;
+        std::atomic<uinteger> next_queue_;
+        std::atomic<bool> stop_;
+
+        // Identifies the pool & queue of the calling thread, if it is a worker
+        inline static thread_local thread_pool* current_pool_ { nullptr };
+        inline static thread_local uinteger current_idx_ { 0 };
+
+        bool
+        pop_task( const uinteger& _idx, task_t& _task ) noexcept;
+        void
+        push_task( task_t&& _task );
+        void
+        worker_loop( const uinteger& _idx ) noexcept;
+
+    public:
+        explicit thread_pool( const uinteger& n_threads = 0 );
+        ~thread_pool();
+
+        thread_pool( const thread_pool& _other ) = delete;
+        thread_pool& operator=( const thread_pool& _other ) = delete;
+        thread_pool( thread_pool&& _other ) = delete;
+        thread_pool& operator=( thread_pool&& _other ) = delete;
+
+        [[nodiscard]] uinteger size() const noexcept { return static_cast<uinteger>(workers_.size()); }
+
+        [[nodiscard]] bool in_worker() const noexcept { return current_pool_ == this; }
+
+        // Finish queued tasks & join the workers, later submits throw. Called by the destructor.
+        void
+        shutdown() noexcept;
+
+        // Queue f(args...), arguments are bound as with std::bind (use std::ref / std::cref for references)
+        template <typename F, typename... Args>
+        auto
+        submit( F&& f, Args&&... args ) -> std::future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>>;
+
+        // Block until _future is ready. Not from a worker, which could be blocking the task itself:
+        // tasks wait on their sub-tasks through a task_group.
+        template <typename T>
+        T
+        wait( std::future<T>& _future );
+
+        // Default worker count: all hardware threads, but at least one
+        static uinteger
+        default_size() noexcept {
+            const auto n = std::thread::hardware_concurrency();
+            return n > 0 ? static_cast<uinteger>(n) : 1;
+        }
+    };
+
+
+    inline
+    thread_pool::thread_pool( const uinteger& n_threads ) :
+        n_queued_ { 0 },
+        next_queue_ { 0 },
+        stop_ { false } {
+        const uinteger n { n_threads > 0 ? n_threads : default_size() };
+
+        queues_.reserve(n);
+        for ( uinteger i { 0 }; i < n; ++i ) { queues_.emplace_back(std::make_unique<task_queue>()); }
+
+        workers_.reserve(n);
+        for ( uinteger i { 0 }; i < n; ++i ) { workers_.emplace_back(&thread_pool::worker_loop, this, i); }
+    }
+
+    inline
+    thread_pool::~thread_pool() { shutdown(); }
+
+    inline void
+    thread_pool::shutdown() noexcept {
+        {
+            std::lock_guard lock { wake_mtx_ };
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for ( auto& worker : workers_ ) {
+            if ( worker.joinable() ) { worker.join(); }
+        }
+    }
+
+    inline void
+    thread_pool::push_task( task_t&& _task ) {
+        if ( stop_ ) { throw std::runtime_error("<thread_pool::push_task> Pool has been shut down."); }
+
+        const uinteger idx {
+            in_worker()
+                ? current_idx_
+                : next_queue_.fetch_add(1) % static_cast<uinteger>(queues_.size())
+        };
+
+        /*
+        * n_queued_ changes under the queue's lock alongside the deque, so a
+        * pop can't see the task before it is counted (the count would wrap).
+        * Taking wake_mtx_ before notifying stops a worker missing the wake
+        * between checking n_queued_ & blocking.
+        */
+        {
+            auto& queue = *queues_[idx];
+            std::lock_guard lock { queue.mtx };
+            if ( in_worker() ) { queue.tasks.emplace_front(std::move(_task)); }
+            else { queue.tasks.emplace_back(std::move(_task)); }
+            ++n_queued_;
+        }
+
+        { std::lock_guard lock { wake_mtx_ }; }
+        wake_.notify_one();
+    }
+
+    inline bool
+    thread_pool::pop_task( const uinteger& _idx, task_t& _task ) noexcept {
+        const auto n_queues = static_cast<uinteger>(queues_.size());
+
+        // Own queue first (front), then steal from the back of the others
+        for ( uinteger i { 0 }; i < n_queues; ++i ) {
+            auto& queue = *queues_[(_idx + i) % n_queues];
+            std::lock_guard lock { queue.mtx };
+            if ( queue.tasks.empty() ) { continue; }
+
+            if ( i == 0 ) {
+                _task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            else {
+                _task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            --n_queued_;
+            return true;
+        }
+
+        return false;
+    }
+
+    inline void
+    thread_pool::worker_loop( const uinteger& _idx ) noexcept {
+        current_pool_ = this;
+        current_idx_ = _idx;
+
+        while ( true ) {
+            task_t task;
+            if ( pop_task(_idx, task) ) {
+                task();
+                continue;
+            }
+
+            std::unique_lock lock { wake_mtx_ };
+            wake_.wait(lock, [this] { return stop_ || n_queued_ > 0; });
+            if ( stop_ && n_queued_ == 0 ) { return; }
+        }
+    }
+
+    template <typename F, typename... Args>
+    auto
+    thread_pool::submit( F&& f, Args&&... args )
+    -> std::future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>> {
+        using result_t = std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>;
+
+        // packaged_task is move-only, std::function requires copyable targets
+        auto task =
+            std::make_shared<std::packaged_task<result_t()>>(
+                std::bind(std::forward<F>(f), std::forward<Args>(args)...)
+            );
+        auto future = task->get_future();
+
+        push_task([task] { (*task)(); });
+
+        return future;
+    }
+
+    template <typename T>
+    T
+    thread_pool::wait( std::future<T>& _future ) {
+        if ( in_worker() ) { throw std::logic_error("<thread_pool::wait> Called from a worker, use a task_group."); }
+        return _future.get();
+    }
+
+
+    /*
+    * Sub-tasks of a single call, e.g one file's parse chunks. Each run(...)
+    * queues the task on the group & a stub on the pool which takes the next
+    * of the group's tasks, if any are left. wait() runs the group's queued
+    * tasks on the calling thread, then blocks until those taken by workers
+    * finish. It never takes other work from the pool, so nesting & the
+    * memory held by a worker's stack stay bounded to the group.
+    * The first exception thrown by a task is rethrown by wait().
+    */
+    class task_group
+    {
+    private:
+        struct state
+        {
+            std::mutex                        mtx;
+            std::condition_variable           done;
+            std::deque<std::function<void()>> tasks;
+            uinteger                          n_pending { 0 };
+            std::exception_ptr                error;
+        };
+
+        thread_pool&           pool_;
+        std::shared_ptr<state> state_;
+
+        // Runs one of the group's queued tasks, false if there were none left
+        static bool
+        run_one( state& _state ) noexcept;
+
+    public:
+        explicit task_group( thread_pool& _pool ) :
+            pool_ { _pool },
+            state_ { std::make_shared<state>() } {}
+
+        // Tasks may reference the caller's frame, they're finished before it unwinds
+        ~task_group() {
+            try { wait(); }
+            catch ( ... ) {}
+        }
+
+        task_group( const task_group& _other ) = delete;
+        task_group& operator=( const task_group& _other ) = delete;
+
+        template <typename F>
+        void
+        run( F&& f );
+
+        void
+        wait();
+    };
+
+
+    inline bool
+    task_group::run_one( state& _state ) noexcept {
+        std::function<void()> task;
+        {
+            std::lock_guard lock { _state.mtx };
+            if ( _state.tasks.empty() ) { return false; }
+            task = std::move(_state.tasks.front());
+            _state.tasks.pop_front();
+        }
+
+        std::exception_ptr error;
+        try { task(); }
+        catch ( ... ) { error = std::current_exception(); }
+
+        {
+            std::lock_guard lock { _state.mtx };
+            if ( error && !_state.error ) { _state.error = error; }
+            if ( --_state.n_pending == 0 ) { _state.done.notify_all(); }
+        }
+        return true;
+    }
+
+    template <typename F>
+    void
+    task_group::run( F&& f ) {
+        {
+            std::lock_guard lock { state_->mtx };
+            state_->tasks.emplace_back(std::forward<F>(f));
+            ++state_->n_pending;
+        }
+        // The stub holds the state, it may run after the group has finished & finds nothing left
+        pool_.push_task([state = state_] { run_one(*state); });
+    }
+
+    inline void
+    task_group::wait() {
+        while ( run_one(*state_) ) {}
+
+        std::unique_lock lock { state_->mtx };
+        state_->done.wait(lock, [this] { return state_->n_pending == 0; });
+        if ( state_->error ) { std::rethrow_exception(std::exchange(state_->error, nullptr)); }
+    }
+
+
+    // Slot holding the shared pool, see shared_thread_pool_slot()
+    struct shared_pool_slot
+    {
+        std::mutex                   mtx;
+        std::shared_ptr<thread_pool> pool;
+    };
+
+    /*
+    * Deliberately leaked: destroyed as a static it would join the workers
+    * during DLL_PROCESS_DETACH, under the loader lock every exiting thread
+    * also needs. release_shared_thread_pool() drops the pool from an
+    * ordinary call instead.
+    */
+    inline shared_pool_slot&
+    shared_thread_pool_slot() noexcept {
+        static auto* slot { new shared_pool_slot {} };
+        return *slot;
+    }
+
+    /*
+    * Process-wide executor used by file_data. Requesting a different
+    * size replaces the shared instance, existing holders keep the old
+    * pool alive until their work completes.
+    */
+    inline std::shared_ptr<thread_pool>
+    shared_thread_pool( const uinteger& n_threads = 0 ) {
+        auto& [mtx, pool] { shared_thread_pool_slot() };
+        const uinteger n { n_threads > 0 ? n_threads : thread_pool::default_size() };
+
+        std::lock_guard lock { mtx };
+        if ( !pool || pool->size() != n ) {
+            pool = std::make_shared<thread_pool>(n);
+        }
+        return pool;
+    }
+
+    /*
+    * Drops the shared instance, its workers are joined once the last holder
+    * (e.g. a file_data) releases it. The next shared_thread_pool() call
+    * starts a new pool.
+    */
+    inline void
+    release_shared_thread_pool() noexcept {
+        std::shared_ptr<thread_pool> pool;
+        {
+            auto& slot { shared_thread_pool_slot() };
+            std::lock_guard lock { slot.mtx };
+            pool = std::move(slot.pool);
+        }
+    }
+} // NAMESPACE: burn_in_data_report
@@ -10,19 +10,20 @@ namespace burn_in_data_report
     {
     private:
         file_data file_;
-        indices_t ranges_;
-        indices_t filters_;
-        // filter currently applied to data
-
-        IMap int_data_; // int data
-        DMap i_errors_; // int error vals
-        DMap double_data_; // double data
-        DMap d_errors_; // double error vals
-        SMap string_data_; // string data
-        DMap s_errors_; // string error vals (always filled with NaN)
-        std::map<std::string, DataType> type_map_; // Maps keys to data type
-
-        uinteger n_rows_;
+        indices_t ranges_;  // Cycles, as ranges of the selected rows
+        indices_t filters_; // Selection of the current filter: ranges of file_'s rows, empty keeps every row
+
+        std::set<column_id> loaded_; // Loaded columns
+        /*
+        * Loaded columns with the selection & reduction applied. Computed
+        * from file_'s (never modified) columns when their values are
+        * requested, & dropped whenever the selection or reduction changes,
+        * so filtering, loading & undoing touch no data.
+        */
+        mutable column_table data_;
+        mutable column_table errors_; // Error vals of each computed column, DOUBLE (always NaN for strings)
+        mutable uint64_t     generation_ { next_generation() }; // New whenever computed columns are dropped
+
         reduction_type reduction_type_; // Vars for reduced data
         avg_type average_type_;
         uinteger n_group_;
@@ -32,17 +33,34 @@ namespace burn_in_data_report
         // is initialized
         bool initialized_;
 
+        // Values of loaded column _id, computed on first request
+        [[nodiscard]] const column_table::column&
+        values( const column_id& _id ) const;
+
+        // Rows of _id kept by the selection, before any reduction
+        [[nodiscard]] uinteger
+        selected_rows( const column_id& _id ) const;
+
+        // Whether the current reduction changes _id
         [[nodiscard]] bool
-        update_n_rows();
+        reduced( const column_id& _id ) const;
+
+        // Drops the computed columns, e.g once the selection or reduction changed
+        void
+        invalidate() const noexcept;
+
+        // file_'s rows changed, the selection no longer lines up with them
+        void
+        reset_filter() noexcept;
 
         bool
         apply_reduction(
-            const std::string& _key,
+            const column_id& _id,
             const reduction_type& _r_type = reduction_type::DEFAULT,
             const avg_type& _a_type = avg_type::stable_mean,
             const uinteger& _n_group = 1,
             const uinteger& _n_points = 0
-        ) noexcept;
+        ) const noexcept;
 
     public:
         spreadsheet();
@@ -51,13 +69,15 @@ namespace burn_in_data_report
                      const std::string& config_loc_name,
                      const uinteger& max_header_sz,
                      const double& max_off_time_minutes,
-                     const bool& do_trimming );
+                     const bool& do_trimming,
+                     const load_options& options );
         explicit
         spreadsheet( const std::vector<std::filesystem::directory_entry>& files,
                      const std::filesystem::directory_entry& config_loc,
                      const uinteger& max_header_sz,
                      const nano& max_off_time,
-                     const bool& do_trimming );
+                     const bool& do_trimming,
+                     const load_options& options );
         explicit
         spreadsheet( const spreadsheet& other );
         spreadsheet&
@@ -86,6 +106,14 @@ namespace burn_in_data_report
         remove_file( const uinteger& index ) noexcept;
         bool
         remove_files( const std::vector<uinteger>& indexes ) noexcept;
+        // Save / open the combined data as a column store (.bidrcs)
+        bool
+        save( const std::filesystem::path& path ) noexcept;
+        bool
+        open( const std::filesystem::path& path ) noexcept;
+        // Replace the spreadsheet contents with already loaded data
+        bool
+        assign( file_data&& data ) noexcept;
         [[nodiscard]] std::vector<std::string>
         get_current_cols() const noexcept;
         [[nodiscard]] std::vector<std::string>
@@ -106,10 +134,6 @@ namespace burn_in_data_report
                 const uinteger& _n,
                 const uinteger& _max_range_sz ) noexcept;
 
-        template <typename T> indices_t
-        apply_filter( std::vector<T>& data,
-                      const indices_t& filter ) noexcept;
-
         bool
         reduce( const reduction_type& r_type,
                 const avg_type& a_type,
@@ -119,7 +143,8 @@ namespace burn_in_data_report
         bool
         clear_spreadsheet() noexcept;
 
-        [[nodiscard]] uinteger n_rows() const noexcept { return n_rows_; }
+        [[nodiscard]] uinteger
+        n_rows() const noexcept;
 
         [[nodiscard]] bool is_initialized() const noexcept { return initialized_; }
 
@@ -135,6 +160,21 @@ namespace burn_in_data_report
         [[nodiscard]] std::vector<double>
         get_error( const std::string& key ) const noexcept;
 
+        /*
+        * Loaded column key without copying: file_data's rows & the active
+        * selection, or the reduced values. Valid while generation() is
+        * unchanged.
+        */
+        template <typename T>
+        [[nodiscard]] column_view<T>
+        view( const std::string& key ) const noexcept;
+
+        [[nodiscard]] column_view<double>
+        view_error( const std::string& key ) const noexcept;
+
+        [[nodiscard]] uint64_t
+        generation() const noexcept { return std::max(generation_, file_.generation()); }
+
         [[nodiscard]] bool
         contains( const std::string& key ) const noexcept;
 
@@ -149,6 +189,11 @@ namespace burn_in_data_report
         [[nodiscard]] auto&
         file_boundaries() noexcept { return file_.file_boundaries(); }
 
+        [[nodiscard]] const file_data&
+        get_file_data() const noexcept { return file_; }
+        [[nodiscard]] file_data&
+        get_file_data() noexcept { return file_; }
+
         [[nodiscard]] auto
         get_load_info() const noexcept { return file_.get_load_info(); }
         [[nodiscard]] auto
@@ -158,7 +203,6 @@ namespace burn_in_data_report
 
     inline
     spreadsheet::spreadsheet() :
-        n_rows_(0),
         reduction_type_(reduction_type::none),
         average_type_(avg_type::stable_mean),
         n_group_(1),
@@ -170,8 +214,8 @@ namespace burn_in_data_report
                               const std::string& config_loc_name,
                               const uinteger& max_header_sz = 256,
                               const double& max_off_time_minutes = 5.0,
-                              const bool& do_trimming = true ) :
-        n_rows_(0),
+                              const bool& do_trimming = true,
+                              const load_options& options = load_options {} ) :
         reduction_type_(reduction_type::none),
         average_type_(avg_type::stable_mean),
         n_group_(1),
@@ -224,7 +268,8 @@ namespace burn_in_data_report
                         config_location,
                         max_header_sz,
                         max_off_time,
-                        do_trimming
+                        do_trimming,
+                        options
                     };
                 initialized_ = true;
                 write_log("Spreadsheet initialized.");
@@ -241,9 +286,9 @@ namespace burn_in_data_report
         const std::filesystem::directory_entry& config_loc,
         const uinteger& max_header_sz = 256,
         const nano& max_off_time = 5min,
-        const bool& do_trimming = true ) :
-        file_(files, config_loc, max_header_sz, max_off_time, do_trimming),
-        n_rows_(0),
+        const bool& do_trimming = true,
+        const load_options& options = load_options {} ) :
+        file_(files, config_loc, max_header_sz, max_off_time, do_trimming, options),
         reduction_type_(reduction_type::none),
         average_type_(avg_type::stable_mean),
         n_group_(1),
@@ -253,16 +298,11 @@ namespace burn_in_data_report
     inline spreadsheet&
     spreadsheet::operator=( const spreadsheet& other ) {
         file_ = other.file_;
-        int_data_ = other.int_data_;
-        i_errors_ = other.i_errors_;
-        double_data_ = other.double_data_;
-        d_errors_ = other.d_errors_;
-        string_data_ = other.string_data_;
-        s_errors_ = other.s_errors_;
-        type_map_ = other.type_map_;
+        data_ = other.data_;
+        errors_ = other.errors_;
         filters_ = other.filters_;
         ranges_ = other.ranges_;
-        n_rows_ = other.n_rows_;
+        loaded_ = other.loaded_;
         reduction_type_ = other.reduction_type_;
         average_type_ = other.average_type_;
         n_group_ = other.n_group_;
@@ -275,16 +315,11 @@ namespace burn_in_data_report
     inline
     spreadsheet::spreadsheet( const spreadsheet& other ) :
         file_(other.file_),
-        int_data_(other.int_data_),
-        i_errors_(other.i_errors_),
-        double_data_(other.double_data_),
-        d_errors_(other.d_errors_),
-        string_data_(other.string_data_),
-        s_errors_(other.s_errors_),
-        type_map_(other.type_map_),
-        filters_(other.filters_),
         ranges_(other.ranges_),
-        n_rows_(other.n_rows_),
+        filters_(other.filters_),
+        loaded_(other.loaded_),
+        data_(other.data_),
+        errors_(other.errors_),
         reduction_type_(other.reduction_type_),
         average_type_(other.average_type_),
         n_group_(other.n_group_),
@@ -294,16 +329,11 @@ namespace burn_in_data_report
     inline spreadsheet&
     spreadsheet::operator=( spreadsheet&& other ) noexcept {
         file_ = std::move(other.file_);
-        int_data_ = std::move(other.int_data_);
-        i_errors_ = std::move(other.i_errors_);
-        double_data_ = std::move(other.double_data_);
-        d_errors_ = std::move(other.d_errors_);
-        string_data_ = std::move(other.string_data_);
-        s_errors_ = std::move(other.s_errors_);
-        type_map_ = std::move(other.type_map_);
+        data_ = std::move(other.data_);
+        errors_ = std::move(other.errors_);
         ranges_ = std::move(other.ranges_);
         filters_ = std::move(other.filters_);
-        n_rows_ = other.n_rows_;
+        loaded_ = std::move(other.loaded_);
         reduction_type_ = other.reduction_type_;
         average_type_ = other.average_type_;
         n_group_ = other.n_group_;
@@ -316,81 +346,85 @@ namespace burn_in_data_report
     inline
     spreadsheet::spreadsheet( spreadsheet&& other ) noexcept :
         file_(std::move(other.file_)),
-        int_data_(std::move(other.int_data_)),
-        i_errors_(std::move(other.i_errors_)),
-        double_data_(std::move(other.double_data_)),
-        d_errors_(std::move(other.d_errors_)),
-        string_data_(std::move(other.string_data_)),
-        s_errors_(std::move(other.s_errors_)),
-        type_map_(std::move(other.type_map_)),
-        n_rows_(other.n_rows_),
+        ranges_(std::move(other.ranges_)),
+        filters_(std::move(other.filters_)),
+        loaded_(std::move(other.loaded_)),
+        data_(std::move(other.data_)),
+        errors_(std::move(other.errors_)),
         reduction_type_(other.reduction_type_),
         average_type_(other.average_type_),
         n_group_(other.n_group_),
         n_points_(other.n_points_),
         initialized_(other.initialized_) {}
 
-    [[nodiscard]] inline bool
-    spreadsheet::update_n_rows() {
-        try {
-            bool result { true };
-            uinteger size { 0 };
-            write_log("update_n_rows:");
+    inline const column_table::column&
+    spreadsheet::values( const column_id& _id ) const {
+        if ( data_.contains(_id) ) { return data_.at(_id); }
+        if ( !loaded_.contains(_id) ) {
+            throw std::out_of_range(std::format("Column \"{}\" isn't loaded.", column_ids::title(_id)));
+        }
 
-            for ( const auto& [key, type] : type_map_ ) {
-                switch ( type ) {
-                case DataType::INTEGER: {
-                    if ( size == 0 ) {
-                        size = static_cast<uinteger>(int_data_.at(key).size());
-                    }
-                    else {
-                        if ( size != static_cast<uinteger>(int_data_.at(key).size()) ) {
-                            throw
-                                std::runtime_error("\tDLL: <spreadsheet::update_n_rows> Data length mismatch.");
-                        }
-                    }
-                }
-                break;
-                case DataType::DOUBLE: {
-                    if ( size == 0 ) {
-                        size = static_cast<uinteger>(double_data_.at(key).size());
-                    }
-                    else {
-                        if ( size != static_cast<uinteger>(double_data_.at(key).size()) ) {
-                            throw
-                                std::runtime_error("DLL: <spreadsheet::update_n_rows> Data length mismatch.");
-                        }
-                    }
-                }
-                break;
-                case DataType::STRING: {
-                    if ( size == 0 ) {
-                        size = static_cast<uinteger>(string_data_.at(key).size());
-                    }
-                    else {
-                        if ( size != static_cast<uinteger>(string_data_.at(key).size()) ) {
-                            throw
-                                std::runtime_error("DLL: <spreadsheet::update_n_rows> Data length mismatch.");
-                        }
-                    }
-                }
-                break;
-                case DataType::NONE:
-                    result = false;
-                    break;
-                }
-            }
+        // Nothing to select or reduce, the base column is the result
+        const auto& base { file_.columns().at(_id) };
+        if ( filters_.empty() && !reduced(_id) ) { return base; }
 
-            if ( result ) {
-                n_rows_ = size;
-                write_log(std::format("n_rows_: {}", n_rows_));
-            }
+        // A new highest id may move the computed columns, & any views of them
+        if ( const auto held { data_.ids() }; !held.empty() && _id > held.back() ) { generation_ = next_generation(); }
 
-            return result;
+        auto& column { data_.add(_id, base.type) };
+        std::visit([this, &column]<typename C>( const C& _rows ) {
+            std::get<C>(column.values) = filters_.empty() ? _rows : select_rows(_rows, filters_);
+        }, base.values);
+        errors_.add<double>(_id).clear();
+
+        if ( !apply_reduction(_id, reduction_type_, average_type_, n_group_, n_points_) ) {
+            data_.erase(_id);
+            errors_.erase(_id);
+            throw std::runtime_error(std::format("Failed to reduce \"{}\".", column_ids::title(_id)));
+        }
+
+        return data_.at(_id);
+    }
+
+    inline uinteger
+    spreadsheet::selected_rows( const column_id& _id ) const {
+        if ( filters_.empty() ) { return file_.columns().rows(_id); }
+        return std::accumulate(filters_.cbegin(), filters_.cend(), static_cast<uinteger>(0),
+                               []( const uinteger x, const range_t& p ) { return x + (p.second - p.first); });
+    }
+
+    inline bool
+    spreadsheet::reduced( const column_id& _id ) const {
+        return reduction_type_ != reduction_type::none || selected_rows(_id) >= MAX_ROWS;
+    }
+
+    inline void
+    spreadsheet::invalidate() const noexcept {
+        data_.clear();
+        errors_.clear();
+        generation_ = next_generation();
+    }
+
+    inline void
+    spreadsheet::reset_filter() noexcept {
+        filters_.clear();
+        ranges_.clear();
+        invalidate();
+    }
+
+    inline uinteger
+    spreadsheet::n_rows() const noexcept {
+        try {
+            if ( loaded_.empty() ) { return 0; }
+
+            const column_id id { *loaded_.cbegin() };
+            if ( !reduced(id) ) { return selected_rows(id); }
+
+            return std::visit([]( const auto& _rows ) { return static_cast<uinteger>(_rows.size()); }, values(id).values);
         }
         catch ( const std::exception& err ) {
-            write_err_log(err, "DLL: <spreadsheet::update_n_rows>");
-            return false;
+            write_err_log(err, "DLL: <spreadsheet::n_rows>");
+            return 0;
         }
     }
 
@@ -406,6 +440,8 @@ namespace burn_in_data_report
     ) noexcept {
         try {
             file_ = file_data { files, config_loc, header_max_lim, max_off_time };
+            loaded_.clear();
+            reset_filter();
             return check_valid_state(file_.get_load_info());
         }
         catch ( const std::exception& err ) {
@@ -417,7 +453,11 @@ namespace burn_in_data_report
     // COMPLETE?
     inline bool
     spreadsheet::add_file( const std::filesystem::directory_entry& file ) noexcept {
-        try { return file_.add_file(file); }
+        try {
+            // The selection was over the old rows
+            reset_filter();
+            return file_.add_file(file);
+        }
         catch ( const std::exception& err ) {
             write_err_log(err, "DLL: <spreadsheet::add_file>");
             return false;
@@ -428,7 +468,10 @@ namespace burn_in_data_report
     inline bool
     spreadsheet::add_files(
         const std::vector<std::filesystem::directory_entry>& files ) noexcept {
-        try { return file_.add_files(files); }
+        try {
+            reset_filter();
+            return file_.add_files(files);
+        }
         catch ( const std::exception& err ) {
             write_err_log(err, "DLL: <spreadsheet::add_files>");
             return false;
@@ -438,7 +481,10 @@ namespace burn_in_data_report
     // COMPLETE?
     inline bool
     spreadsheet::remove_file( const uinteger& index ) noexcept {
-        try { return file_.remove_file(index); }
+        try {
+            reset_filter();
+            return file_.remove_file(index);
+        }
         catch ( const std::exception& err ) {
             write_err_log(err, "DLL: <spreadsheet::remove_file>");
             return false;
@@ -448,13 +494,53 @@ namespace burn_in_data_report
     // COMPLETE?
     inline bool
     spreadsheet::remove_files( const std::vector<uinteger>& indexes ) noexcept {
-        try { return file_.remove_files(indexes); }
+        try {
+            reset_filter();
+            return file_.remove_files(indexes);
+        }
         catch ( const std::exception& err ) {
             write_err_log(err, "DLL: <spreadsheet::remove_files");
             return false;
         }
     }
 
+    inline bool
+    spreadsheet::save( const std::filesystem::path& path ) noexcept {
+        try { return file_.save_store(path); }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <spreadsheet::save>");
+            return false;
+        }
+    }
+
+    // Replaces the spreadsheet contents, columns are read from the store as they are loaded
+    inline bool
+    spreadsheet::open( const std::filesystem::path& path ) noexcept {
+        try {
+            file_data store_data;
+            if ( !store_data.open_store(path) ) { return false; }
+            return assign(std::move(store_data));
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <spreadsheet::open>");
+            return false;
+        }
+    }
+
+    inline bool
+    spreadsheet::assign( file_data&& data ) noexcept {
+        try {
+            if ( !clear_spreadsheet() ) { return false; }
+            file_ = std::move(data);
+            initialized_ = true;
+            return true;
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <spreadsheet::assign>");
+            return false;
+        }
+    }
+
     /*
     * WARNING:
     * This is incredibly janky! There are probably smarter ways to build this whole
@@ -463,8 +549,8 @@ namespace burn_in_data_report
     // COMPLETE?
     inline bool
     spreadsheet::apply_reduction(
-        // Column title
-        const std::string& _key,
+        // Column id
+        const column_id& _id,
         // 3 bit flag indicating how to apply reduction. Default: {100}
         const reduction_type& _r_type,
         // Indicates how to apply reduction. Default: {avg_type::stable_mean}
@@ -473,37 +559,24 @@ namespace burn_in_data_report
         const uinteger& _n_group,
         // Averaging to produce n_points_ at the end. Default: 0
         const uinteger& _n_points
-    ) noexcept {
+    ) const noexcept {
         try {
             /*
-            * All reductions are done in place, so data must be reset to get
-            * original state back.
+            * All reductions are done in place on the computed column, which
+            * values() rebuilds from the base data.
             */
 
-            // Check _key is valid
-            if ( !type_map_.contains(_key) ) { return false; }
+            // Check _id is valid
+            if ( !data_.contains(_id) ) { return false; }
 
             std::vector<integer> i_reduced;
             std::vector<double> d_reduced;
-            std::vector<std::string> s_reduced;
-            const DataType type = type_map_.at(_key);
+            string_column s_reduced;
+            const DataType type = data_.type(_id);
             auto ranges_copy{ ranges_ };
 
             // get current no. rows. Will be updated as reductions applied
-            uinteger no_rows { 0 };
-            switch ( type ) {
-            case DataType::INTEGER:
-                no_rows = static_cast<uinteger>(int_data_.at(_key).size());
-                break;
-            case DataType::DOUBLE:
-                no_rows = static_cast<uinteger>(double_data_.at(_key).size());
-                break;
-            case DataType::STRING:
-                no_rows = static_cast<uinteger>(string_data_.at(_key).size());
-                break;
-            case DataType::NONE:
-                break;
-            }
+            const uinteger no_rows { data_.rows(_id) };
 
             write_log(std::format("Average type: {}", avg_string.at(_a_type)));
             write_log(std::format("no_rows: {}", no_rows));
@@ -551,52 +624,36 @@ namespace burn_in_data_report
                 switch ( type ) {
                 case DataType::INTEGER: {
                     const auto& [avgs, std] =
-                        avg(int_data_[_key], i_errors_[_key], avg_func_map<integer>);
-                    int_data_[_key] = avgs;
-                    i_errors_[_key] = std;
+                        avg(data_.get<integer>(_id), errors_.add<double>(_id), avg_func_map<integer>);
+                    data_.get<integer>(_id) = avgs;
+                    errors_.get<double>(_id) = std;
                 } break;
                 case DataType::DOUBLE: {
                     const auto& [avgs, std] =
-                        avg(double_data_[_key], d_errors_[_key], avg_func_map<double>);
-                    double_data_[_key] = avgs;
-                    d_errors_[_key] = std;
+                        avg(data_.get<double>(_id), errors_.add<double>(_id), avg_func_map<double>);
+                    data_.get<double>(_id) = avgs;
+                    errors_.get<double>(_id) = std;
                 } break;
                 case DataType::STRING: {
                     /*
                      * Averaging string data doesn't make much sense.
                      * Instead, concatenate data & give NaN as the standard deviation.
+                     * Each cycle's values are joined straight from the column's
+                     * dictionary, repeated results share one code.
                      */
-                    const auto& data = string_data_.at(_key);
-
-                    // { { start_idx, end_idx }, ... } ==> { { start_idx, ..., end_idx }, ... }
-                    constexpr auto range_to_span =
-                        [](const range_t& p){ return std::views::iota(p.first, p.second); };
-                    // idx -> data[idx]
-                    const auto idx_to_str =
-                        [&data](const uinteger& idx){ return data[idx]; };
-                    // { { start_idx, ..., end_idx }, ... } ==> { { data[start_idx], ..., data[end_idx] }, ... }
-                    const auto span_to_strs =
-                        [&idx_to_str](const auto& x) { return x | std::views::transform(idx_to_str); };
-                    // { { data[start_idx], ..., data[end_idx] }, ... } ==> { { data[start_idx] + ", " + ... + data[end_idx] }, ... }
-                    constexpr auto strs_to_str =
-                        [](const auto& x){ return concatenate(x.begin(), x.end(), std::string_view{", "}); };
-
-                    const auto filt_rng_to_str =
-                        std::views::transform(range_to_span)
-                        | std::views::transform(span_to_strs)
-                        | std::views::transform(strs_to_str);
-
-                    std::vector<std::string> tmp;
-                    tmp.reserve(ranges_copy.size());
-                    s_errors_[_key].clear();
-                    s_errors_.reserve(ranges_copy.size());
-
-                    for ( const auto& s : ranges_copy | filt_rng_to_str ) {
-                        tmp.emplace_back(s);
-                        s_errors_[_key].emplace_back(std::numeric_limits<double>::signaling_NaN());
+                    auto& data = data_.get<std::string>(_id);
+
+                    s_reduced.reserve(static_cast<uinteger>(ranges_copy.size()));
+                    auto& s_errors { errors_.add<double>(_id) };
+                    s_errors.clear();
+                    s_errors.reserve(ranges_copy.size());
+
+                    for ( const auto& [first, last] : ranges_copy ) {
+                        s_reduced.push_back(data.join(first, last, ", "));
+                        s_errors.emplace_back(std::numeric_limits<double>::signaling_NaN());
                     }
 
-                    string_data_[_key] = std::move(tmp);
+                    data = std::move(s_reduced);
                 } break;
                 case DataType::NONE: {
                     throw std::runtime_error("Invalid type received.");
@@ -697,24 +754,24 @@ namespace burn_in_data_report
                 switch ( type ) {
                 case DataType::INTEGER: {
                     avg(
-                        int_data_.at(_key),
-                        i_reduced, i_errors_[_key],
+                        data_.get<integer>(_id),
+                        i_reduced, errors_.add<double>(_id),
                         _n_group, avg_func_map<integer>
                     );
 
-                    int_data_[_key] = i_reduced;
+                    data_.get<integer>(_id) = i_reduced;
                     break;
                 }
                 case DataType::DOUBLE: {
-                    avg( double_data_.at( _key ),
-                         d_reduced, d_errors_[_key],
+                    avg( data_.get<double>(_id),
+                         d_reduced, errors_.add<double>(_id),
                         _n_group, avg_func_map<double>);
 
-                    double_data_[_key] = d_reduced;
+                    data_.get<double>(_id) = d_reduced;
                     break;
                 }
                 case DataType::STRING: {
-                    auto& data { string_data_[_key] };
+                    auto& data { data_.get<std::string>(_id) };
 
                     const uinteger _no_rows { static_cast<uinteger>(data.size()) / _n_group}, offset{ static_cast<uinteger>(data.size()) % _n_group };
 
@@ -723,20 +780,21 @@ namespace burn_in_data_report
 
                     for ( uinteger i{ 0 }; i < _no_rows; ++i ) {
                         const uinteger first{ i * _n_group }, last{ (i + 1) * _n_group };
-                        s_reduced.emplace_back(concatenate(data.cbegin() + first, data.cbegin() + last, ","));
+                        s_reduced.push_back(data.join(first, last, ","));
                     }
                     if ( offset > 0 ) {
-                        s_reduced.emplace_back(concatenate(data.cbegin() + _no_rows * _n_group, data.cend(), ","));
+                        s_reduced.push_back(data.join(_no_rows * _n_group, data.size(), ","));
                     }
                     
-                    s_errors_[_key].clear();
-                    s_errors_[_key].insert(
-                        s_errors_[_key].end(),
+                    auto& s_errors { errors_.add<double>(_id) };
+                    s_errors.clear();
+                    s_errors.insert(
+                        s_errors.end(),
                         _no_rows + offset,
                         std::numeric_limits<double>::signaling_NaN()
                     );
 
-                    string_data_[_key] = s_reduced;
+                    data = std::move(s_reduced);
                     break;
                 }
                 case DataType::NONE: { break; }
@@ -831,23 +889,23 @@ namespace burn_in_data_report
 
                 switch ( type ) {
                 case DataType::INTEGER: {
-                    avg(int_data_.at(_key),
-                        i_reduced, i_errors_[_key],
+                    avg(data_.get<integer>(_id),
+                        i_reduced, errors_.add<double>(_id),
                         _n_points, avg_func_map<integer>);
 
-                    int_data_[_key] = i_reduced;
+                    data_.get<integer>(_id) = i_reduced;
                     break;
                 }
                 case DataType::DOUBLE: {
-                    avg(double_data_.at( _key ),
-                        d_reduced, d_errors_[_key],
+                    avg(data_.get<double>(_id),
+                        d_reduced, errors_.add<double>(_id),
                         _n_points, avg_func_map<double>);
 
-                    double_data_[_key] = d_reduced;
+                    data_.get<double>(_id) = d_reduced;
                     break;
                 }
                 case DataType::STRING: {
-                    auto& data = string_data_.at(_key);
+                    auto& data = data_.get<std::string>(_id);
 
                     const uinteger n_points =
                     MAX_ROWS < _n_points || _n_points == 0
@@ -860,33 +918,22 @@ namespace burn_in_data_report
 
                     for ( uinteger i{ 0 }; i < n_points - overflow; ++i ) {
                         const uinteger start{i * n_group}, end{(i+1) * n_group};
-                        s_reduced.emplace_back(
-                            concatenate(
-                                data.cbegin() + start,
-                                data.cbegin() + end,
-                                ","
-                            )
-                        );
+                        s_reduced.push_back(data.join(start, end, ","));
                     }
                     const uinteger startpoint{ (n_points - overflow) * n_group };
                     for ( uinteger i{ 0 }; i < overflow; ++i ) {
                         const uinteger start{startpoint + i * n_group + i},
                             end{startpoint + (i + 1) * n_group + i + 1};
-                        s_reduced.emplace_back(
-                            concatenate(
-                                data.cbegin() + start,
-                                data.cbegin() + end,
-                                ","
-                            )
-                        );
+                        s_reduced.push_back(data.join(start, end, ","));
                     }
 
-                    s_errors_[_key].insert(
-                        s_errors_.at(_key).end(), n_points,
+                    auto& s_errors { errors_.add<double>(_id) };
+                    s_errors.insert(
+                        s_errors.end(), n_points,
                         std::numeric_limits<double>::signaling_NaN()
                      );
 
-                    string_data_[_key] = s_reduced;
+                    data = std::move(s_reduced);
                     break;
                 }
                 case DataType::NONE: { break; }
@@ -909,30 +956,19 @@ namespace burn_in_data_report
                          const uinteger& n_group,
                          const uinteger& n_points ) noexcept {
         try {
-            write_log(std::format("Reducing data... (current size: {})", n_rows_));
-
-            bool result { true };
+            /*
+            * Replaces any previous reduction, the selected rows are reduced
+            * again as each column's values are requested.
+            */
+            write_log(std::format("Reducing data... ({} ranges)", ranges_.size()));
 
             reduction_type_ = r_type;
             average_type_ = a_type;
             n_group_ = n_group;
             n_points_ = n_points;
+            invalidate();
 
-            for ( const auto& key : type_map_ | std::views::keys ) {
-                write_log(std::format("Reducing {}...", key));
-                write_log(std::format("{} - ranges_.size(): {}", key, ranges_.size()));
-                bool tmp{ apply_reduction(key, r_type, a_type, n_group, n_points) };
-                write_log( tmp ? "Success." : "Fail.");
-                result &= tmp;
-            }
-
-            if ( result ) { ranges_.clear(); }
-
-            result &= update_n_rows();
-
-            write_log(std::format("Done. (new size: {})", n_rows_));
-
-            return result;
+            return true;
         }
         catch ( const std::exception& err ) {
             write_err_log(err, "DLL: <spreadsheet::reduce>");
@@ -945,11 +981,12 @@ namespace burn_in_data_report
     spreadsheet::get_current_cols() const noexcept {
         try {
             std::vector<std::string> cols;
-            cols.reserve(type_map_.size());
+            cols.reserve(loaded_.size());
 
-            for ( const auto& title : type_map_ | std::views::keys ) {
-                cols.emplace_back(title);
+            for ( const auto& id : loaded_ ) {
+                cols.emplace_back(column_ids::title(id));
             }
+            std::ranges::sort(cols);
 
             return cols;
         }
@@ -973,10 +1010,8 @@ namespace burn_in_data_report
     inline bool
     spreadsheet::load_column( const std::string& _key ) noexcept {
         try {
-            auto dtype { DataType::NONE };
-
             // Check column exists & not already loaded
-            if ( file_.contains(_key) && type_map_.contains(_key) ) {
+            if ( file_.contains(_key) && loaded_.contains(column_ids::find(_key)) ) {
                 // Column is already loaded, exit
                 write_log(std::format("<spreadsheet::load_column> Column already loaded ({}).", _key));
                 return true;
@@ -986,65 +1021,13 @@ namespace burn_in_data_report
             }
 
             write_log(std::format("<spreadsheet::load_column> Loading {}", _key));
-            dtype = file_.get_col_types().at(_key);
-            
-            const bool ranges_empty { ranges_.empty() };
-
-            // Add to type_map_
-            type_map_[_key] = dtype;
-
-            // Load unfiltered data, then:
-            // Apply filters & reductions
-            switch ( dtype ) {
-            case DataType::INTEGER: {
-                int_data_[_key] = file_.get_i(_key);
-                i_errors_[_key] = {};
-                ranges_ = apply_filter( int_data_.at(_key), filters_);
-                apply_reduction(_key,
-                                reduction_type_,
-                                average_type_,
-                                n_group_,
-                                n_points_);
-                if ( ranges_empty ) { ranges_.clear(); }
-                if ( !update_n_rows() ) {
-                    throw std::runtime_error("DLL: <spreadsheet::load_column> Data length mismatch.");
-                }
-                break;
-            }
-            case DataType::DOUBLE: {
-                double_data_[_key] = file_.get_d(_key);
-                d_errors_[_key] = {};
-                ranges_ = apply_filter(double_data_.at(_key), filters_);
-                apply_reduction(_key,
-                                reduction_type_,
-                                average_type_,
-                                n_group_,
-                                n_points_);
-                if ( ranges_empty ) { ranges_.clear(); }
-                if ( !update_n_rows() ) {
-                    throw std::runtime_error("DLL: <spreadsheet::load_column> Data length mismatch.");
-                }
-                break;
-            }
-            case DataType::STRING: {
-                string_data_[_key] = file_.get_s(_key);
-                s_errors_[_key] = {};
-                ranges_ = apply_filter(string_data_.at(_key), filters_);
-                apply_reduction(_key,
-                                reduction_type_,
-                                average_type_,
-                                n_group_,
-                                n_points_);
-                if ( ranges_empty ) { ranges_.clear(); }
-                if ( !update_n_rows() ) {
-                    throw std::runtime_error("DLL: <spreadsheet::load_column> Data length mismatch.");
-                }
-                break;
-            }
-            case DataType::NONE:
-                break;
+            if ( !file_.page_in(_key) ) {
+                throw std::runtime_error(std::format("Failed to read {} from the column store.", _key));
             }
 
+            // Values are selected & reduced from file_ when first requested
+            if ( file_.get_col_types().at(_key) != DataType::NONE ) { loaded_.insert(column_ids::intern(_key)); }
+
             return true;
         }
         catch ( const std::exception& err ) {
@@ -1084,35 +1067,20 @@ namespace burn_in_data_report
             * - Remove from relevant *_errors column
             */
 
-            const auto type_data_iter { type_map_.find(_key) };
+            const column_id id { column_ids::find(_key) };
 
             // Invalid _key
-            if ( type_data_iter == type_map_.end() ) {
+            if ( !loaded_.contains(id) ) {
                 write_log(std::format("<spreadsheet::unload_column> Column not found ({})", _key));
                 return false;
             }
             write_log(std::format("<spreadsheet::unload_column> Column found ({})", _key));
-            const auto d_type = type_data_iter->second;
-            type_map_.erase(type_data_iter);
 
             // Remove data
-            switch ( d_type ) {
-            case DataType::INTEGER:
-                int_data_.erase(_key);
-                i_errors_.erase(_key);
-                break;
-            case DataType::DOUBLE:
-                double_data_.erase(_key);
-                d_errors_.erase(_key);
-                break;
-            case DataType::STRING:
-                string_data_.erase(_key);
-                s_errors_.erase(_key);
-                break;
-            case DataType::NONE:
-                write_err_log(std::runtime_error("DLL: <spreadsheet::unload_column> NONE type received."));
-                return false;
-            }
+            loaded_.erase(id);
+            data_.erase(id);
+            errors_.erase(id);
+            generation_ = next_generation();
 
             return true;
         }
@@ -1142,43 +1110,6 @@ namespace burn_in_data_report
         }
     }
 
-    template <typename T> indices_t
-    spreadsheet::apply_filter( std::vector<T>& data,
-                               const indices_t& filter ) noexcept {
-        try {
-            if ( filter.empty() ) { return indices_t{}; }
-
-            indices_t ranges;
-            ranges.reserve(filter.size());
-
-            const auto sz =
-                std::accumulate(
-                    filter.cbegin(), filter.cend(),
-                    static_cast<uinteger>(0),
-                    [](const auto& lhs, const range_t& rhs)
-                    { return lhs + (rhs.second - rhs.first); }
-                );
-
-            std::vector<T> tmp;
-            tmp.reserve(sz);
-
-            uinteger pos{ 0 };
-            for ( const auto& [first, last] : filter ) {
-                tmp.insert(tmp.cend(), data.cbegin() + first, data.cbegin() + last);
-                ranges.emplace_back(pos, pos + (last - first));
-                pos += last - first;
-            }
-
-            data = std::move(tmp);
-
-            return ranges;
-        }
-        catch ( const std::exception& err ) {
-            write_err_log(err, "DLL: <spreadsheet::apply_filter>");
-            return indices_t{};
-        }
-    }
-
     // COMPLETE?
     inline bool
     spreadsheet::filter( const std::string& _key,
@@ -1186,28 +1117,35 @@ namespace burn_in_data_report
                          const uinteger& _n = 2,
                          const uinteger& _max_range_sz = 0 ) noexcept {
         try {
+            /*
+            * The filter is found from the unmodified rows of _key & replaces
+            * any previous filter. It's kept as a selection of file_'s rows,
+            * no loaded data is copied until its values are requested.
+            */
             write_log("Filtering data:");
 
             // Check valid cutoff fraction & that _key exists / has been loaded
-            if ( !(0 <= _cutoff && _cutoff < 1 && type_map_.contains(_key)) ) {
+            const column_id id { column_ids::find(_key) };
+            if ( !(0 <= _cutoff && _cutoff < 1 && loaded_.contains(id)) ) {
                 throw std::runtime_error("Invalid filter parameters received.");
             }
-            if ( type_map_.at(_key) == DataType::STRING ||
-                 type_map_.at(_key) == DataType::NONE ) {
+            const auto& base { file_.columns() };
+            if ( base.type(id) == DataType::STRING ) {
                 throw std::runtime_error("Selected column type is unsupported.");
             }
 
             if ( _cutoff == 0.0 && _max_range_sz == 1 ) {
                 write_log(" - cutoff = 0.0, max_range_sz = 1 -> No filter required.");
+                reset_filter();
                 return true;
             }
 
             // get DataType of provided _key
-            const DataType dtype = type_map_.at(_key);
+            const DataType dtype = base.type(id);
 
-            // Map key --> cutoff value for filter
-            std::map<std::string, integer> int_cutoff;
-            std::map<std::string, double> double_cutoff;
+            // Cutoff value for filter
+            integer int_cutoff { 0 };
+            double double_cutoff { 0 };
 
             constexpr auto calculate_cutoff =
                 []<ArithmeticType T>
@@ -1218,30 +1156,28 @@ namespace burn_in_data_report
                     return result;
                 };
 
-            // Calculate cutoff values as fraction of max datapoint
-            for ( const auto& [key, type] : type_map_ ) {
-                switch ( type ) {
-                case DataType::INTEGER: {
-                    int_cutoff[key] =
-                        _cutoff == 0.0 ?
-                        std::numeric_limits<integer>::lowest() :
-                        calculate_cutoff(check_min(int_data_.at(_key)), check_max(int_data_.at(_key)), _cutoff);
-                    if ( key == _key ) { write_log(std::format(" - {} Cutoff: {}", _key, int_cutoff[key])); }
-                }
-                break;
-                case DataType::DOUBLE: {
-                    double_cutoff[key] =
-                        _cutoff == 0.0 ?
-                        std::numeric_limits<double>::lowest() :
-                        calculate_cutoff(check_min(double_data_.at(_key)), check_max(double_data_.at(_key)), _cutoff);
-                    if ( key == _key ) { write_log(std::format(" - {} Cutoff: {}", _key, double_cutoff[key])); }
-                }
-                break;
-                case DataType::STRING:
-                    break;
-                case DataType::NONE:
-                    throw std::runtime_error("Invalid DataType received.");
-                }
+            // Calculate cutoff value as fraction of max datapoint
+            switch ( dtype ) {
+            case DataType::INTEGER: {
+                const auto& data { base.get<integer>(id) };
+                int_cutoff =
+                    _cutoff == 0.0 ?
+                    std::numeric_limits<integer>::lowest() :
+                    calculate_cutoff(check_min(data), check_max(data), _cutoff);
+                write_log(std::format(" - {} Cutoff: {}", _key, int_cutoff));
+            }
+            break;
+            case DataType::DOUBLE: {
+                const auto& data { base.get<double>(id) };
+                double_cutoff =
+                    _cutoff == 0.0 ?
+                    std::numeric_limits<double>::lowest() :
+                    calculate_cutoff(check_min(data), check_max(data), _cutoff);
+                write_log(std::format(" - {} Cutoff: {}", _key, double_cutoff));
+            }
+            break;
+            default:
+                throw std::runtime_error("Invalid DataType received.");
             }
 
             /*
@@ -1357,21 +1293,19 @@ namespace burn_in_data_report
             indices_t filters{};
             switch ( dtype ) {
             case DataType::INTEGER:
-                filters = ExtractRanges(int_data_.at(_key),
-                                         int_cutoff.at(_key),
+                filters = ExtractRanges(base.get<integer>(id),
+                                         int_cutoff,
                                          _n, _max_range_sz);
                 break;
             case DataType::DOUBLE:
-                filters = ExtractRanges(double_data_.at(_key),
-                                         double_cutoff.at(_key),
+                filters = ExtractRanges(base.get<double>(id),
+                                         double_cutoff,
                                          _n, _max_range_sz);
                 break;
             default:
                 throw std::runtime_error("Invalid filter type received.");
             }
 
-            filters_ = filters;
-
             const uinteger sz =
                 std::accumulate(filters.cbegin(), filters.cend(),
                                 static_cast<uinteger>( 0 ),
@@ -1380,28 +1314,16 @@ namespace burn_in_data_report
                 );
             write_log(std::format("Done. Filter size: {} ranges, {} elements.", filters.size(), sz));
 
-            // Make in-place changes to loaded data
-            for ( const auto& [title, type] : type_map_ ) {
-                switch ( type ) {
-                case DataType::INTEGER: {
-                    ranges_ = apply_filter<integer>(int_data_.at(title), filters);
-                } break;
-                case DataType::DOUBLE: {
-                    ranges_ = apply_filter<double>(double_data_.at(title), filters);
-                } break;
-                case DataType::STRING: {
-                    ranges_ = apply_filter<std::string>(string_data_.at(title), filters);
-                } break;
-                case DataType::NONE: {
-                    throw std::runtime_error("DataType::NONE encountered.");
-                }
-                }
-            }
-
-            // Update n_rows_
-            if ( !update_n_rows() ) {
-                throw std::runtime_error("Failed to filter data.");
+            // Each filtered range is a cycle of the selected rows
+            ranges_.clear();
+            ranges_.reserve(filters.size());
+            uinteger pos { 0 };
+            for ( const auto& [first, last] : filters ) {
+                ranges_.emplace_back(pos, pos + (last - first));
+                pos += last - first;
             }
+            filters_ = std::move(filters);
+            invalidate();
 
             return true;
         }
@@ -1417,20 +1339,9 @@ namespace burn_in_data_report
         try {
             file_ = file_data();
 
-            int_data_.clear();
-            double_data_.clear();
-            string_data_.clear();
-
-            i_errors_.clear();
-            d_errors_.clear();
-            s_errors_.clear();
-
-            type_map_.clear();
-
-            filters_.clear();
-            ranges_.clear();
+            loaded_.clear();
+            reset_filter();
 
-            n_rows_ = 0;
             reduction_type_ = reduction_type { 100 };
             average_type_ = avg_type::stable_mean;
             n_group_ = 1;
@@ -1448,7 +1359,7 @@ namespace burn_in_data_report
 
     inline [[nodiscard]] std::vector<integer>
     spreadsheet::get_i( const std::string& key ) const noexcept {
-        try { return int_data_.at(key); }
+        try { return std::get<std::vector<integer>>(values(column_ids::find(key)).values); }
         catch ( const std::exception& err ) {
             write_err_log(err, "DLL: <spreadsheet::get_i>");
             return {};
@@ -1457,7 +1368,7 @@ namespace burn_in_data_report
 
     inline [[nodiscard]] std::vector<double>
     spreadsheet::get_d( const std::string& key ) const noexcept {
-        try {  return double_data_.at(key); }
+        try { return std::get<std::vector<double>>(values(column_ids::find(key)).values); }
         catch ( const std::exception& err ) {
             write_err_log(err, "DLL: <spreadsheet::get_d>");
             return {};
@@ -1466,7 +1377,7 @@ namespace burn_in_data_report
 
     inline [[nodiscard]] std::vector<std::string>
     spreadsheet::get_s( const std::string& key ) const noexcept {
-        try { return string_data_.at(key); }
+        try { return std::get<string_column>(values(column_ids::find(key)).values).to_strings(); }
         catch ( const std::exception& err ) {
             write_err_log(err, "DLL: <spreadsheet::get_s>");
             return {};
@@ -1476,35 +1387,55 @@ namespace burn_in_data_report
     inline [[nodiscard]] std::vector<double>
     spreadsheet::get_error( const std::string& key ) const noexcept {
         try {
-            std::vector<double> errors;
+            // Unreduced columns have no errors
+            const column_id id { column_ids::find(key) };
+            static_cast<void>(values(id));
+            const auto* errors { errors_.find<double>(id) };
+            return errors ? *errors : std::vector<double> {};
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <spreadsheet::get_error>");
+            return {};
+        }
+    }
 
-            switch ( type_map_.at(key) ) {
-            case DataType::INTEGER: {
-                errors = i_errors_.at(key);
-            }
-                break;
-            case DataType::DOUBLE: {
-                errors = d_errors_.at(key);
-            }
-                break;
-            case DataType::STRING: {
-                errors = s_errors_.at(key);
-            }
-            break;
-            case DataType::NONE: { errors = {}; }
+    template <typename T>
+    column_view<T>
+    spreadsheet::view( const std::string& key ) const noexcept {
+        try {
+            const column_id id { column_ids::find(key) };
+            if ( !loaded_.contains(id) ) { throw std::out_of_range(std::format("Column \"{}\" isn't loaded.", key)); }
+
+            // Selected rows are read in place, only reductions are computed
+            if ( !filters_.empty() && !reduced(id) ) {
+                return column_view<T> { file_.columns().get<T>(id), &filters_, generation() };
             }
+            return column_view<T> { std::get<column_table::storage<T>>(values(id).values), nullptr, generation() };
+        }
+        catch ( const std::exception& err ) {
+            write_err_log(err, "DLL: <spreadsheet::view>");
+            return column_view<T> {};
+        }
+    }
 
-            return errors;
+    inline column_view<double>
+    spreadsheet::view_error( const std::string& key ) const noexcept {
+        try {
+            // Unreduced columns have no errors
+            const column_id id { column_ids::find(key) };
+            static_cast<void>(values(id));
+            const auto* errors { errors_.find<double>(id) };
+            return errors ? column_view<double> { *errors, nullptr, generation() } : column_view<double> {};
         }
         catch ( const std::exception& err ) {
-            write_err_log(err, "DLL: <spreadsheet::get_error>");
-            return {};
+            write_err_log(err, "DLL: <spreadsheet::view_error>");
+            return column_view<double> {};
         }
     }
 
     inline [[nodiscard]] bool
     spreadsheet::contains( const std::string& key ) const noexcept {
-        try { return type_map_.contains(key); }
+        try { return loaded_.contains(column_ids::find(key)); }
         catch ( const std::exception& err ) {
             write_err_log(err, "DLL: <spreadsheet::contains>");
             return false;
@@ -1535,41 +1466,13 @@ namespace burn_in_data_report
         try {
             write_log("Clearing changes:");
 
-            int_data_.clear();
-            i_errors_.clear();
-            double_data_.clear();
-            d_errors_.clear();
-            string_data_.clear();
-            s_errors_.clear();
-
-            ranges_.clear();
-            filters_.clear();
+            // file_ is never modified, dropping the selection & reduction restores it
+            reset_filter();
 
             reduction_type_ = reduction_type::none;
             average_type_ = avg_type::stable_mean;
             n_group_ = 1;
             n_points_ = 0;
-            n_rows_ = 0;
-
-            for ( const auto& [key, type] : type_map_ ) {
-                switch ( type ) {
-                case DataType::INTEGER:
-                    int_data_[key] = file_.get_i(key);
-                    break;
-                case DataType::DOUBLE:
-                    double_data_[key] = file_.get_d(key);
-                    break;
-                case DataType::STRING:
-                    string_data_[key] = file_.get_s(key);
-                    break;
-                case DataType::NONE:
-                    break;
-                }
-            }
-
-            if ( !update_n_rows() ) {
-                throw std::runtime_error("DLL: <spreadsheet::load_column> Data length mismatch.");
-            }
 
             return true;
         }
@@ -15,3 +15,6 @@
 
 // Spreadsheet Functionality
 #include "S__Spreadsheet_Classes/BIDR_Spreadsheet.h"
+
+// Run storage (SQLite)
+#include "F__SQL_IO/BIDR_SQLite.h"